@@ -0,0 +1,173 @@
+
+#ifndef SERIALIST_BLOCK_PROCESSOR_H
+#define SERIALIST_BLOCK_PROCESSOR_H
+
+#include <algorithm>
+
+#include "core/generation_graph.h"
+#include "core/collections/vec.h"
+#include "core/types/event.h"
+#include "core/types/time_point.h"
+#include "core/types/trigger.h"
+#include "core/utility/traits.h"
+
+namespace serialist {
+
+/**
+ * @brief Processes a GenerationGraph one block [start, end) at a time, rather than once per callback.
+ *
+ * Each block is subdivided into `num_substeps` equally sized steps, where the graph is processed at the end of each
+ * step, i.e. at `start + (i + 1) * (end - start) / num_substeps`, and every output produced is reported with its
+ * fractional offset within the block. This lets a host call the graph with large blocks (e.g. every 5-10 ms) while
+ * still scheduling events independently of the callback's jitter.
+ *
+ * An output produced at a substep occurred somewhere within that substep's step. Outputs positioned within their
+ * step (e.g. `Trigger` and `Event`, see `Trigger::with_step_offset`), such as the crossings of a PhasePulsator's
+ * cursor or the notes of a MakeNote triggered by them, are reported at their interpolated offset, splitting each
+ * output into one event per distinct position. Note that a position is only as accurate as the node producing it:
+ * e.g. a PhasePulsator's jumps, or any output without a position, are reported at the end of their step, i.e. with
+ * the timing resolution `(end - start) / num_substeps`.
+ */
+template<typename T = Event>
+class BlockProcessor {
+public:
+    struct BlockEvent {
+        double offset;  // in [0.0, 1.0], relative to the start and duration of the block (1.0 coincides with `end`)
+        TimePoint time; // time of the substep that produced the event
+        std::size_t output_index;
+        Voices<T> voices;
+    };
+
+
+    /**
+     * @throw std::invalid_argument if `num_substeps` is zero
+     */
+    explicit BlockProcessor(GenerationGraph& graph, std::size_t num_substeps = 1)
+            : m_graph(graph)
+            , m_num_substeps(num_substeps) {
+        if (num_substeps == 0)
+            throw std::invalid_argument("Number of substeps must be > 0");
+    }
+
+
+    /**
+     * Observes `node` in the graph, keeping it live even if it isn't reachable from any root.
+     * @throw std::invalid_argument if `node` isn't part of the graph
+     * @return index of the output, used to identify its events in the processed blocks
+     */
+    std::size_t add_output(Node<T>& node) {
+        m_graph.observe(node);
+        m_outputs.push_back(&node);
+        return m_outputs.size() - 1;
+    }
+
+
+    /**
+     * Processes the interval [start, end), evaluating the graph at time points in (start, end]. If the meter of `end`
+     * differs from the meter of `start`, the meter change is applied at the first barline within the block. Tempo and
+     * transport state are taken from `start`.
+     *
+     * @return all events produced within the block, ordered by offset
+     * @throw std::invalid_argument if `end` is before `start`
+     */
+    Vec<BlockEvent> process_block(const TimePoint& start, const TimePoint& end) {
+        if (end < start)
+            throw std::invalid_argument("End of block must not be before its start");
+
+        auto substep_ticks = (end.get_tick() - start.get_tick()) / static_cast<double>(m_num_substeps);
+        bool meter_change = start.get_meter() != end.get_meter();
+
+        Vec<BlockEvent> events;
+
+        auto t = start;
+        for (std::size_t i = 0; i < m_num_substeps; ++i) {
+            if (meter_change) {
+                meter_change = !t.increment_with_meter_change(substep_ticks, end.get_meter());
+            } else {
+                t.increment(substep_ticks);
+            }
+
+            m_graph.process(t);
+
+            for (std::size_t j = 0; j < m_outputs.size(); ++j) {
+                // The output was evaluated in the graph cycle above: processing it again only returns its current value
+                const auto& voices = m_outputs[j]->process();
+                if (!voices.is_empty_like())
+                    append_events(events, i, t, j, voices);
+            }
+        }
+
+        if constexpr (utils::has_step_offset_v<T>) {
+            // events of different outputs within the same substep may be positioned in any order
+            std::stable_sort(events.begin(), events.end(), [](const BlockEvent& a, const BlockEvent& b) {
+                return a.offset < b.offset;
+            });
+        }
+
+        return events;
+    }
+
+
+    void set_num_substeps(std::size_t num_substeps) {
+        if (num_substeps == 0)
+            throw std::invalid_argument("Number of substeps must be > 0");
+        m_num_substeps = num_substeps;
+    }
+
+
+    std::size_t get_num_substeps() const { return m_num_substeps; }
+
+
+    const std::vector<Node<T>*>& get_outputs() const { return m_outputs; }
+
+private:
+    /** @param step_offset position within the step of `substep`, where 1.0 is the time point the graph was processed at */
+    double block_offset(std::size_t substep, double step_offset = 1.0) const {
+        return (static_cast<double>(substep) + step_offset) / static_cast<double>(m_num_substeps);
+    }
+
+
+    void append_events(Vec<BlockEvent>& events
+                       , std::size_t substep
+                       , const TimePoint& t
+                       , std::size_t output_index
+                       , const Voices<T>& voices) const {
+        if constexpr (utils::has_step_offset_v<T>) {
+            Vec<double> step_offsets;
+            for (const auto& voice: voices) {
+                for (const auto& element: voice) {
+                    if (!step_offsets.contains(element.get_step_offset()))
+                        step_offsets.append(element.get_step_offset());
+                }
+            }
+
+            if (step_offsets.size() > 1) {
+                step_offsets.sort();
+                for (auto step_offset: step_offsets) {
+                    auto split = voices.cloned();
+                    for (auto& voice: split) {
+                        voice.filter([step_offset](const T& element) {
+                            return element.get_step_offset() == step_offset;
+                        });
+                    }
+                    events.append(BlockEvent{block_offset(substep, step_offset), t, output_index, std::move(split)});
+                }
+                return;
+            }
+
+            events.append(BlockEvent{block_offset(substep, step_offsets.first_or(1.0)), t, output_index, voices});
+        } else {
+            events.append(BlockEvent{block_offset(substep), t, output_index, voices});
+        }
+    }
+
+
+    GenerationGraph& m_graph;
+    std::size_t m_num_substeps;
+
+    std::vector<Node<T>*> m_outputs;
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_BLOCK_PROCESSOR_H
@@ -0,0 +1,343 @@
+
+#ifndef SERIALIST_FLAT_VOICES_H
+#define SERIALIST_FLAT_VOICES_H
+
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+#include "core/collections/vec.h"
+#include "core/collections/voices.h"
+
+namespace serialist {
+
+/**
+ * @brief Contiguous (CSR) layout of a `Voices<T>`: all values of all voices are stored in a single array, and voice
+ *        `i` is the range `[offsets[i], offsets[i + 1])` of that array.
+ *
+ * Unlike `Voices<T>`, where each voice is a separate allocation, iterating over all voices of a `FlatVoices<T>`
+ * is a single linear pass over memory, which also makes it possible to apply a kernel over all values of all
+ * voices at once (see `values_mut`). As with `Voices<T>`, a `FlatVoices<T>` always has at least one voice.
+ */
+template<typename T>
+class FlatVoices {
+public:
+    static constexpr std::size_t AUTO_VOICES = Voices<T>::AUTO_VOICES;
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+
+    /** Non-owning view of a single voice, invalidated by any mutation of the underlying FlatVoices */
+    class VoiceView {
+    public:
+        VoiceView(const T* begin, const T* end) : m_begin(begin), m_end(end) {}
+
+
+        explicit VoiceView(const Voice<T>& voice)
+                : VoiceView(voice.vector().data(), voice.vector().data() + voice.size()) {}
+
+
+        const T* begin() const { return m_begin; }
+
+
+        const T* end() const { return m_end; }
+
+
+        const T& operator[](std::size_t index) const { return m_begin[index]; }
+
+
+        std::size_t size() const { return static_cast<std::size_t>(m_end - m_begin); }
+
+
+        bool empty() const { return m_begin == m_end; }
+
+
+        template<typename U = T>
+        U first_or(const U& fallback) const {
+            if (empty())
+                return fallback;
+            return static_cast<U>(*m_begin);
+        }
+
+
+        Voice<T> to_vec() const {
+            auto output = Voice<T>::allocated(size());
+            output.vector_mut().insert(output.end(), m_begin, m_end);
+            return output;
+        }
+
+    private:
+        const T* m_begin;
+        const T* m_end;
+    };
+
+
+    // =========================== CONSTRUCTORS ==========================
+
+    /**
+     * @param values all values of all voices, in voice order
+     * @param offsets start of each voice in `values`, followed by `values.size()`. Must be non-decreasing and
+     *                contain at least two entries (i.e. at least one voice)
+     */
+    FlatVoices(Vec<T> values, Vec<std::size_t> offsets) : m_values(std::move(values)), m_offsets(std::move(offsets)) {
+        if (m_offsets.size() < 2 || m_offsets[0] != 0 || m_offsets[m_offsets.size() - 1] != m_values.size()
+            || !m_offsets.is_sorted()) {
+            throw std::invalid_argument("invalid offsets for FlatVoices");
+        }
+    }
+
+
+    explicit FlatVoices(const Voices<T>& voices) : FlatVoices(allocated(voices.size(), voices.numel())) {
+        for (const auto& voice: voices) {
+            append_voice(voice.begin(), voice.end());
+        }
+    }
+
+
+    static FlatVoices zeros(std::size_t num_voices) {
+        if (num_voices == 0) {
+            throw std::invalid_argument("num_voices must be greater than 0");
+        }
+
+        return FlatVoices(Vec<T>(), Vec<std::size_t>::zeros(num_voices + 1));
+    }
+
+
+    static FlatVoices empty_like() {
+        return zeros(1);
+    }
+
+
+    /**
+     * Converts every value of `voices` to `T` while adapting it to `num_voices` voices, in a single pass over `voices`.
+     * Equivalent to `FlatVoices(voices.adapted_to(num_voices).template as_type<T>())`, without any intermediate copies.
+     * As `num_voices == 0` is `AUTO_VOICES`, which keeps the number of voices of `voices`, the result is never empty
+     */
+    template<typename U>
+    static FlatVoices adapted_from(const Voices<U>& voices, std::size_t num_voices) {
+        if (num_voices == AUTO_VOICES)
+            num_voices = voices.size();
+
+        std::size_t num_values = 0;
+        for (std::size_t i = 0; i < num_voices; ++i) {
+            num_values += voices[i % voices.size()].size();
+        }
+
+        auto flat = allocated(num_voices, num_values);
+        auto& values = flat.m_values.vector_mut();
+        for (std::size_t i = 0; i < num_voices; ++i) {
+            for (const auto& value: voices[i % voices.size()]) {
+                values.push_back(static_cast<T>(value));
+            }
+            flat.m_offsets.append(values.size());
+        }
+        return flat;
+    }
+
+
+    Voices<T> to_voices() const {
+        auto voices = Vec<Voice<T> >::allocated(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            voices.append((*this)[i].to_vec());
+        }
+        return Voices<T>(std::move(voices));
+    }
+
+
+    // =========================== OPERATORS ==========================
+
+    bool operator==(const FlatVoices& other) const {
+        return m_offsets == other.m_offsets && m_values == other.m_values;
+    }
+
+
+    bool operator!=(const FlatVoices& other) const {
+        return !(*this == other);
+    }
+
+
+    VoiceView operator[](std::size_t index) const {
+        return {m_values.vector().data() + m_offsets[index], m_values.vector().data() + m_offsets[index + 1]};
+    }
+
+
+    // =========================== MUTATORS ==========================
+
+    /** Appends a new voice containing the values in `[first, last)`, which must not refer to this FlatVoices */
+    template<typename InputIt>
+    FlatVoices& append_voice(InputIt first, InputIt last) {
+        auto& values = m_values.vector_mut();
+        values.insert(values.end(), first, last);
+        m_offsets.append(values.size());
+        return *this;
+    }
+
+
+    FlatVoices& append_voice(const Voice<T>& voice) {
+        return append_voice(voice.begin(), voice.end());
+    }
+
+
+    /**
+     * merges two `FlatVoices<T>` of different sizes, equivalent to `Voices<T>::merge_uneven`.
+     */
+    FlatVoices& merge_uneven(const FlatVoices& other, bool allow_expand, std::size_t offset = 0) {
+        auto other_size = other.size() + offset;
+        auto num_voices = allow_expand ? std::max(size(), other_size) : size();
+
+        auto merged = allocated(num_voices, m_values.size() + other.m_values.size());
+        for (std::size_t i = 0; i < num_voices; ++i) {
+            auto& values = merged.m_values.vector_mut();
+            if (i < size()) {
+                auto voice = (*this)[i];
+                values.insert(values.end(), voice.begin(), voice.end());
+            }
+            if (i >= offset && i < other_size) {
+                auto voice = other[i - offset];
+                values.insert(values.end(), voice.begin(), voice.end());
+            }
+            merged.m_offsets.append(values.size());
+        }
+
+        *this = std::move(merged);
+        return *this;
+    }
+
+
+    /**
+     * Equivalent to `Voices<T>::adapted_to`: removes voices from the end, or appends copies of the existing voices
+     * (cycling from the first one) until there are `target_num_voices` voices. `target_num_voices == 0` is
+     * `AUTO_VOICES`, which leaves the FlatVoices unchanged, hence it's never adapted to zero voices.
+     */
+    FlatVoices& adapted_to(std::size_t target_num_voices) {
+        auto original_size = size();
+        if (original_size == target_num_voices || target_num_voices == AUTO_VOICES)
+            return *this;
+
+        assert(original_size > 0);
+
+        auto& values = m_values.vector_mut();
+        auto& offsets = m_offsets.vector_mut();
+
+        if (target_num_voices < original_size) {
+            offsets.resize(target_num_voices + 1);
+            values.erase(values.begin() + static_cast<long>(offsets.back()), values.end());
+            return *this;
+        }
+
+        for (std::size_t i = original_size; i < target_num_voices; ++i) {
+            auto source = i % original_size;
+            // SmallVector::insert allows the inserted range to refer to the vector itself
+            values.insert(values.end()
+                          , values.begin() + static_cast<long>(offsets[source])
+                          , values.begin() + static_cast<long>(offsets[source + 1]));
+            offsets.push_back(values.size());
+        }
+        return *this;
+    }
+
+
+    // =========================== ACCESSORS ==========================
+
+    template<typename U = T>
+    Vec<U> firsts_or(const U& fallback) const {
+        auto output = Vec<U>::allocated(size());
+
+        for (std::size_t i = 0; i < size(); ++i) {
+            output.append(m_offsets[i] == m_offsets[i + 1] ? fallback : static_cast<U>(m_values[m_offsets[i]]));
+        }
+
+        return output;
+    }
+
+
+    /** @return all values of all voices, in voice order. Unlike `Voices<T>::flattened`, this is a single copy */
+    Vec<T> flattened() const {
+        return m_values;
+    }
+
+
+    /**
+     * Transposes the voices structure, equivalent to `Voices<T>::transpose`.
+     */
+    FlatVoices<std::optional<T> > transpose() const {
+        std::size_t max_voice_length = 0;
+        for (std::size_t i = 0; i < size(); ++i) {
+            max_voice_length = std::max(max_voice_length, m_offsets[i + 1] - m_offsets[i]);
+        }
+
+        if (max_voice_length == 0) {
+            return FlatVoices<std::optional<T> >::empty_like();
+        }
+
+        auto values = Vec<std::optional<T> >::allocated(max_voice_length * size());
+        auto offsets = Vec<std::size_t>::allocated(max_voice_length + 1);
+        offsets.append(0);
+
+        for (std::size_t i = 0; i < max_voice_length; ++i) {
+            for (std::size_t j = 0; j < size(); ++j) {
+                auto index = m_offsets[j] + i;
+                if (index < m_offsets[j + 1]) {
+                    values.append(m_values[index]);
+                } else {
+                    values.append(std::nullopt);
+                }
+            }
+            offsets.append(values.size());
+        }
+
+        return FlatVoices<std::optional<T> >(std::move(values), std::move(offsets));
+    }
+
+
+    std::size_t size() const {
+        return m_offsets.size() - 1;
+    }
+
+
+    std::size_t numel() const {
+        return m_values.size();
+    }
+
+
+    /**
+    * @return true if every voice is empty
+    */
+    bool is_empty_like() const {
+        return m_values.empty();
+    }
+
+
+    const Vec<T>& values() const { return m_values; }
+
+
+    /** Mutable access to all values of all voices. The number of values must not be changed */
+    Vec<T>& values_mut() { return m_values; }
+
+
+    /** @return `size() + 1` offsets, where voice `i` is `values()[offsets()[i] .. offsets()[i + 1]]` */
+    const Vec<std::size_t>& offsets() const { return m_offsets; }
+
+private:
+    /**
+     * @return a FlatVoices without any voices, to be populated by `append_voice`. Private, as every public
+     *         FlatVoices must have at least one voice (`adapted_to` cycles through the existing voices)
+     */
+    static FlatVoices allocated(std::size_t num_voices, std::size_t num_values) {
+        return FlatVoices(Vec<T>::allocated(num_values), num_voices);
+    }
+
+
+    FlatVoices(Vec<T> values, std::size_t num_voices)
+            : m_values(std::move(values)), m_offsets(Vec<std::size_t>::allocated(num_voices + 1)) {
+        m_offsets.append(0);
+    }
+
+
+    Vec<T> m_values;
+    Vec<std::size_t> m_offsets;
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_FLAT_VOICES_H
@@ -47,12 +47,14 @@ public:
     }
 
 
-    std::optional<std::reference_wrapper<T>> find(const std::function<bool(const T&)>& f) {
+    template<typename Predicate>
+    std::optional<std::reference_wrapper<T>> find(Predicate&& f) {
         return m_held.find(f);
     }
 
 
-    std::optional<std::reference_wrapper<const T>> find(const std::function<bool(const T&)>& f) const {
+    template<typename Predicate>
+    std::optional<std::reference_wrapper<const T>> find(Predicate&& f) const {
         return m_held.find(f);
     }
 
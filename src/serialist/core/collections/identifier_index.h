@@ -0,0 +1,188 @@
+
+#ifndef SERIALIST_IDENTIFIER_INDEX_H
+#define SERIALIST_IDENTIFIER_INDEX_H
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace serialist {
+
+/**
+ * @brief Trie of hierarchical identifiers on format `a::b::c`, mapping each identifier to one or more values.
+ *
+ * Lookups cost O(depth) rather than O(size), and collecting all values under a base identifier only visits
+ * the matching subtree.
+ */
+template<typename T>
+class IdentifierIndex {
+public:
+    static constexpr std::string_view SEPARATOR = "::";
+
+
+    void insert(const std::string& identifier, T value) {
+        auto* node = &m_root;
+        for (const auto& segment: split(identifier)) {
+            auto& child = node->children[std::string(segment)];
+            if (!child)
+                child = std::make_unique<TrieNode>();
+            node = child.get();
+        }
+        node->values.push_back({m_next_order++, std::move(value)});
+        ++m_size;
+    }
+
+
+    /** @return true if `value` was stored under `identifier` */
+    bool remove(const std::string& identifier, const T& value) {
+        auto path = path_to(identifier);
+        if (path.empty())
+            return false;
+
+        auto& values = path.back()->values;
+        auto it = std::find_if(values.begin(), values.end(), [&value](const Entry& e) { return e.value == value; });
+        if (it == values.end())
+            return false;
+
+        values.erase(it);
+        --m_size;
+
+        prune(identifier, path);
+        return true;
+    }
+
+
+    /** @return the first value stored under exactly `identifier`, if any */
+    std::optional<T> find(const std::string& identifier) const {
+        auto path = path_to(identifier);
+        if (path.empty() || path.back()->values.empty())
+            return std::nullopt;
+        return path.back()->values.front().value;
+    }
+
+
+    /**
+     * @return all values stored under `base_identifier` or any of its children in insertion order,
+     *         e.g. `base_identifier` "osc" matches identifiers "osc", "osc::freq", "osc::freq::value" but not "osc1"
+     */
+    std::vector<T> find_matching(const std::string& base_identifier) const {
+        auto path = path_to(base_identifier);
+        if (path.empty())
+            return {};
+
+        std::vector<const Entry*> entries;
+        collect(*path.back(), entries);
+
+        // children are visited in hash order
+        std::sort(entries.begin(), entries.end(), [](const Entry* a, const Entry* b) { return a->order < b->order; });
+
+        std::vector<T> matching;
+        matching.reserve(entries.size());
+        for (const auto* entry: entries) {
+            matching.push_back(entry->value);
+        }
+        return matching;
+    }
+
+
+    std::size_t size() const { return m_size; }
+
+
+    bool empty() const { return m_size == 0; }
+
+
+    void clear() {
+        m_root.children.clear();
+        m_root.values.clear();
+        m_size = 0;
+    }
+
+
+private:
+    struct Entry {
+        std::size_t order;
+        T value;
+    };
+
+
+    struct TrieNode {
+        std::unordered_map<std::string, std::unique_ptr<TrieNode>> children;
+        std::vector<Entry> values;
+    };
+
+
+    static std::vector<std::string_view> split(std::string_view identifier) {
+        std::vector<std::string_view> segments;
+
+        std::size_t start = 0;
+        std::size_t end;
+        while ((end = identifier.find(SEPARATOR, start)) != std::string_view::npos) {
+            segments.push_back(identifier.substr(start, end - start));
+            start = end + SEPARATOR.size();
+        }
+        segments.push_back(identifier.substr(start));
+
+        return segments;
+    }
+
+
+    /** @return all nodes from the root to the node of `identifier`, or an empty vector if `identifier` isn't indexed */
+    std::vector<TrieNode*> path_to(const std::string& identifier) const {
+        std::vector<TrieNode*> path{const_cast<TrieNode*>(&m_root)};
+
+        for (const auto& segment: split(identifier)) {
+            const auto& children = path.back()->children;
+            auto it = children.find(std::string(segment));
+            if (it == children.end())
+                return {};
+            path.push_back(it->second.get());
+        }
+
+        return path;
+    }
+
+
+    static void collect(const TrieNode& node, std::vector<const Entry*>& output) {
+        std::vector<const TrieNode*> stack{&node};
+        while (!stack.empty()) {
+            const auto* current = stack.back();
+            stack.pop_back();
+
+            for (const auto& entry: current->values) {
+                output.push_back(&entry);
+            }
+            for (const auto& [_, child]: current->children) {
+                stack.push_back(child.get());
+            }
+        }
+    }
+
+
+    /** Removes all empty nodes on `path`, starting from the leaf */
+    static void prune(const std::string& identifier, std::vector<TrieNode*>& path) {
+        auto segments = split(identifier);
+
+        for (std::size_t i = segments.size(); i > 0; --i) {
+            auto* node = path[i];
+            if (!node->values.empty() || !node->children.empty())
+                return;
+
+            path[i - 1]->children.erase(std::string(segments[i - 1]));
+        }
+    }
+
+
+    TrieNode m_root;
+    std::size_t m_size = 0;
+
+    // insertion index of the next value, such that `find_matching` can return values in insertion order
+    std::size_t m_next_order = 0;
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_IDENTIFIER_INDEX_H
@@ -0,0 +1,515 @@
+
+#ifndef SERIALIST_SMALL_VECTOR_H
+#define SERIALIST_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include "core/utility/cycle_arena.h"
+
+namespace serialist {
+
+/**
+ * @brief Subset of the std::vector interface that stores up to `N` elements inline, and only allocates on the heap
+ *        once it grows beyond `N` elements. With `N == 0`, it behaves like a std::vector.
+ *
+ * Heap buffers are allocated from the memory resource of the calling thread (see `ThreadMemoryResource`), and
+ * returned to the resource they were allocated from.
+ *
+ * Note that unlike std::vector, moving or swapping a SmallVector whose elements are stored inline moves each
+ * element (and invalidates iterators), and that the capacity never drops below `N`.
+ */
+template<typename T, std::size_t N>
+class SmallVector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type INLINE_CAPACITY = N;
+
+
+    SmallVector() noexcept : m_data(inline_data()) {}
+
+
+    explicit SmallVector(size_type count) : SmallVector() {
+        resize(count);
+    }
+
+
+    SmallVector(size_type count, const T& value) : SmallVector() {
+        append_copies(count, value);
+    }
+
+
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt> > >
+    SmallVector(InputIt first, InputIt last) : SmallVector() {
+        append_range(first, last);
+    }
+
+
+    SmallVector(std::initializer_list<T> values) : SmallVector(values.begin(), values.end()) {}
+
+
+    SmallVector(const SmallVector& other) : SmallVector() {
+        copy_from(other);
+    }
+
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : SmallVector() {
+        steal(std::move(other));
+    }
+
+
+    ~SmallVector() {
+        std::destroy(begin(), end());
+        release_heap();
+    }
+
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            release_heap();
+            steal(std::move(other));
+        }
+        return *this;
+    }
+
+
+    SmallVector& operator=(std::initializer_list<T> values) {
+        clear();
+        append_range(values.begin(), values.end());
+        return *this;
+    }
+
+
+    /** @note `value` must not refer to an element of this vector */
+    void assign(size_type count, const T& value) {
+        clear();
+        append_copies(count, value);
+    }
+
+
+    // =========================== ACCESS ==========================
+
+    T& operator[](size_type index) { return m_data[index]; }
+
+
+    const T& operator[](size_type index) const { return m_data[index]; }
+
+
+    T& at(size_type index) {
+        check_index(index);
+        return m_data[index];
+    }
+
+
+    const T& at(size_type index) const {
+        check_index(index);
+        return m_data[index];
+    }
+
+
+    T& front() { return m_data[0]; }
+
+
+    const T& front() const { return m_data[0]; }
+
+
+    T& back() { return m_data[m_size - 1]; }
+
+
+    const T& back() const { return m_data[m_size - 1]; }
+
+
+    T* data() noexcept { return m_data; }
+
+
+    const T* data() const noexcept { return m_data; }
+
+
+    iterator begin() noexcept { return m_data; }
+
+
+    const_iterator begin() const noexcept { return m_data; }
+
+
+    const_iterator cbegin() const noexcept { return m_data; }
+
+
+    iterator end() noexcept { return m_data + m_size; }
+
+
+    const_iterator end() const noexcept { return m_data + m_size; }
+
+
+    const_iterator cend() const noexcept { return m_data + m_size; }
+
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+
+    // =========================== CAPACITY ==========================
+
+    bool empty() const noexcept { return m_size == 0; }
+
+
+    size_type size() const noexcept { return m_size; }
+
+
+    size_type capacity() const noexcept { return m_capacity; }
+
+
+    size_type max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+
+    /** @return true if the elements are stored inline, i.e. no heap allocation is owned */
+    bool is_inline() const noexcept { return m_data == inline_data(); }
+
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity <= m_capacity)
+            return;
+
+        auto* resource = ThreadMemoryResource::get();
+        auto* new_data = allocate(*resource, new_capacity);
+        try {
+            relocate(new_data);
+        } catch (...) {
+            deallocate(*resource, new_data, new_capacity);
+            throw;
+        }
+        replace_buffer(new_data, new_capacity, resource);
+    }
+
+
+    void shrink_to_fit() { /* capacity is kept, as for most std::vector implementations */ }
+
+
+    // =========================== MODIFIERS ==========================
+
+    void clear() noexcept {
+        std::destroy(begin(), end());
+        m_size = 0;
+    }
+
+
+    void push_back(const T& value) { emplace_back(value); }
+
+
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+
+    template<typename... Args>
+    T& emplace_back(Args&& ... args) {
+        if (m_size < m_capacity) {
+            ::new(static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+        } else {
+            // `args` may refer to an element of this vector, which remains valid until the new element is constructed
+            append_constructed(1, [&args...](T* p) { ::new(static_cast<void*>(p)) T(std::forward<Args>(args)...); });
+            return back();
+        }
+        return m_data[m_size++];
+    }
+
+
+    void pop_back() {
+        m_data[--m_size].~T();
+    }
+
+
+    void resize(size_type new_size) {
+        if (new_size <= m_size) {
+            erase(begin() + new_size, end());
+        } else {
+            auto count = new_size - m_size;
+            append_constructed(count, [count](T* p) { std::uninitialized_value_construct_n(p, count); });
+        }
+    }
+
+
+    void resize(size_type new_size, const T& value) {
+        if (new_size <= m_size) {
+            erase(begin() + new_size, end());
+        } else {
+            append_copies(new_size - m_size, value);
+        }
+    }
+
+
+    iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+
+
+    iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+
+
+    iterator insert(const_iterator position, size_type count, const T& value) {
+        auto index = index_of(position);
+        auto old_size = m_size;
+        append_copies(count, value);
+        return rotate_into(index, old_size);
+    }
+
+
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt> > >
+    iterator insert(const_iterator position, InputIt first, InputIt last) {
+        auto index = index_of(position);
+        auto old_size = m_size;
+        append_range(first, last);
+        return rotate_into(index, old_size);
+    }
+
+
+    iterator insert(const_iterator position, std::initializer_list<T> values) {
+        return insert(position, values.begin(), values.end());
+    }
+
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&& ... args) {
+        auto index = index_of(position);
+        auto old_size = m_size;
+        emplace_back(std::forward<Args>(args)...);
+        return rotate_into(index, old_size);
+    }
+
+
+    iterator erase(const_iterator position) {
+        return erase(position, position + 1);
+    }
+
+
+    iterator erase(const_iterator first, const_iterator last) {
+        auto* erase_begin = begin() + index_of(first);
+        auto* erase_end = begin() + index_of(last);
+
+        if (erase_begin != erase_end) {
+            auto* new_end = std::move(erase_end, end(), erase_begin);
+            std::destroy(new_end, end());
+            m_size = static_cast<size_type>(new_end - begin());
+        }
+        return erase_begin;
+    }
+
+
+    void swap(SmallVector& other) {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+
+    // =========================== COMPARISON ==========================
+
+    friend bool operator==(const SmallVector& lhs, const SmallVector& rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+
+    friend bool operator!=(const SmallVector& lhs, const SmallVector& rhs) {
+        return !(lhs == rhs);
+    }
+
+
+    friend bool operator<(const SmallVector& lhs, const SmallVector& rhs) {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+
+private:
+    static T* allocate(std::pmr::memory_resource& resource, size_type capacity) {
+        if (capacity > std::numeric_limits<size_type>::max() / sizeof(T))
+            throw std::length_error("SmallVector: capacity exceeds max_size");
+        return static_cast<T*>(resource.allocate(capacity * sizeof(T), alignof(T)));
+    }
+
+
+    static void deallocate(std::pmr::memory_resource& resource, T* data, size_type capacity) noexcept {
+        resource.deallocate(data, capacity * sizeof(T), alignof(T));
+    }
+
+
+    T* inline_data() noexcept { return reinterpret_cast<T*>(m_inline); }
+
+
+    const T* inline_data() const noexcept { return reinterpret_cast<const T*>(m_inline); }
+
+
+    size_type index_of(const_iterator position) const {
+        return static_cast<size_type>(position - cbegin());
+    }
+
+
+    void check_index(size_type index) const {
+        if (index >= m_size)
+            throw std::out_of_range("SmallVector: index out of range");
+    }
+
+
+    /** moves (or copies, if moving may throw) all elements into `new_data`, without destroying the originals */
+    void relocate(T* new_data) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(begin(), end(), new_data);
+        } else {
+            std::uninitialized_copy(begin(), end(), new_data);
+        }
+    }
+
+
+    /** destroys all elements in the current buffer (relocated to `new_data`) and releases it */
+    void replace_buffer(T* new_data, size_type new_capacity, std::pmr::memory_resource* resource) noexcept {
+        std::destroy(begin(), end());
+        release_heap();
+        m_data = new_data;
+        m_capacity = new_capacity;
+        m_resource = resource;
+    }
+
+
+    void release_heap() noexcept {
+        if (!is_inline()) {
+            deallocate(*m_resource, m_data, m_capacity);
+            m_data = inline_data();
+            m_capacity = N;
+            m_resource = nullptr;
+        }
+    }
+
+
+    /** Precondition: this vector is empty */
+    void copy_from(const SmallVector& other) {
+        reserve(other.m_size);
+        std::uninitialized_copy(other.begin(), other.end(), m_data);
+        m_size = other.m_size;
+    }
+
+
+    /** Precondition: this vector is empty and doesn't own any heap allocation */
+    void steal(SmallVector&& other) {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.begin(), other.end(), inline_data());
+            m_size = other.m_size;
+            other.clear();
+        } else {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            m_resource = other.m_resource;
+
+            other.m_data = other.inline_data();
+            other.m_size = 0;
+            other.m_capacity = N;
+            other.m_resource = nullptr;
+        }
+    }
+
+
+    /**
+     * Constructs `count` elements at the end by calling `construct(p)` once, which must either construct all elements
+     * in [p, p + count) or none of them (as e.g. `std::uninitialized_copy`). The size only grows once all elements
+     * have been constructed. If a reallocation is needed, the new elements are constructed before the existing ones
+     * are relocated, meaning that `construct` may read from existing elements.
+     */
+    template<typename Constructor>
+    void append_constructed(size_type count, Constructor&& construct) {
+        if (count == 0)
+            return;
+
+        if (m_size + count <= m_capacity) {
+            construct(m_data + m_size);
+            m_size += count;
+            return;
+        }
+
+        auto new_capacity = std::max(m_size + count, 2 * m_capacity);
+        auto* resource = ThreadMemoryResource::get();
+        auto* new_data = allocate(*resource, new_capacity);
+
+        try {
+            construct(new_data + m_size);
+            try {
+                relocate(new_data);
+            } catch (...) {
+                std::destroy(new_data + m_size, new_data + m_size + count);
+                throw;
+            }
+        } catch (...) {
+            deallocate(*resource, new_data, new_capacity);
+            throw;
+        }
+
+        replace_buffer(new_data, new_capacity, resource);
+        m_size += count;
+    }
+
+
+    void append_copies(size_type count, const T& value) {
+        append_constructed(count, [count, &value](T* p) { std::uninitialized_fill_n(p, count, value); });
+    }
+
+
+    template<typename InputIt>
+    void append_range(InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            auto count = static_cast<size_type>(std::distance(first, last));
+            append_constructed(count, [&first, &last](T* p) { std::uninitialized_copy(first, last, p); });
+        } else {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+    }
+
+
+    /** moves the elements appended after `old_size` to `index` */
+    iterator rotate_into(size_type index, size_type old_size) {
+        std::rotate(begin() + index, begin() + old_size, end());
+        return begin() + index;
+    }
+
+
+    T* m_data;
+    size_type m_size = 0;
+    size_type m_capacity = N;
+
+    // resource owning the heap buffer, nullptr if the elements are stored inline
+    std::pmr::memory_resource* m_resource = nullptr;
+
+    alignas(T) unsigned char m_inline[N > 0 ? N * sizeof(T) : 1];
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_SMALL_VECTOR_H
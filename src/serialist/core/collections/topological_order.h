@@ -0,0 +1,280 @@
+#ifndef SERIALIST_TOPOLOGICAL_ORDER_H
+#define SERIALIST_TOPOLOGICAL_ORDER_H
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace serialist {
+
+/**
+ * @brief Topological order of a directed graph, maintained incrementally as nodes and edges are added and removed.
+ *
+ * An edge `from -> to` requires `from` to precede `to`. Adding an edge that already agrees with the current order
+ * costs O(1). Otherwise, only the nodes positioned between the two endpoints that are connected to either of them are
+ * reordered (Pearce & Kelly's dynamic topological sort), rather than sorting the full graph again.
+ *
+ * Edges that would close a cycle are not part of the order. They are kept aside as cyclic edges (see `cyclic_edges`),
+ * and are retried whenever an edge or a node is removed.
+ */
+template<typename T, typename Hash = std::hash<T>>
+class TopologicalOrder {
+public:
+    /** Appends `node` to the end of the order. No effect if it already is part of the order */
+    void insert(const T& node) {
+        if (contains(node))
+            return;
+
+        m_entries.emplace(node, Entry{m_order.size(), {}, {}});
+        m_order.emplace_back(node);
+    }
+
+
+    /** Removes `node` along with all of its edges, including cyclic ones */
+    void erase(const T& node) {
+        auto it = m_entries.find(node);
+        if (it == m_entries.end())
+            return;
+
+        for (const auto& successor: it->second.successors) {
+            erase_one(m_entries.at(successor).predecessors, node);
+        }
+
+        for (const auto& predecessor: it->second.predecessors) {
+            erase_one(m_entries.at(predecessor).successors, node);
+        }
+
+        bool removed_edges = !it->second.successors.empty() || !it->second.predecessors.empty();
+
+        m_order[it->second.position] = std::nullopt;
+        m_entries.erase(it);
+        ++m_num_erased;
+
+        m_cyclic.erase(std::remove_if(m_cyclic.begin(), m_cyclic.end(), [&node](const auto& edge) {
+            return edge.first == node || edge.second == node;
+        }), m_cyclic.end());
+
+        if (m_num_erased > m_entries.size())
+            compact();
+
+        if (removed_edges)
+            retry_cyclic_edges();
+    }
+
+
+    bool contains(const T& node) const { return m_entries.find(node) != m_entries.end(); }
+
+
+    /**
+     * Adds an edge requiring `from` to precede `to`. Both nodes must be part of the order.
+     * Parallel edges are allowed, and are removed one at a time by `remove_edge`.
+     *
+     * @return false if the edge would close a cycle, in which case it's added to the cyclic edges instead
+     */
+    bool add_edge(const T& from, const T& to) {
+        auto& from_entry = m_entries.at(from);
+        auto& to_entry = m_entries.at(to);
+
+        if (from == to || (from_entry.position > to_entry.position && !reorder(from, to))) {
+            m_cyclic.emplace_back(from, to);
+            return false;
+        }
+
+        from_entry.successors.push_back(to);
+        to_entry.predecessors.push_back(from);
+        return true;
+    }
+
+
+    /** Removes a single edge from `from` to `to`, whether it's part of the order or a cyclic edge. */
+    void remove_edge(const T& from, const T& to) {
+        auto from_it = m_entries.find(from);
+        auto to_it = m_entries.find(to);
+        if (from_it == m_entries.end() || to_it == m_entries.end())
+            return;
+
+        if (erase_one(from_it->second.successors, to)) {
+            erase_one(to_it->second.predecessors, from);
+            retry_cyclic_edges();
+            return;
+        }
+
+        auto cyclic = std::find(m_cyclic.begin(), m_cyclic.end(), std::make_pair(from, to));
+        if (cyclic != m_cyclic.end())
+            m_cyclic.erase(cyclic);
+    }
+
+
+    /** @return all nodes that `node` must precede through (non-cyclic) edges, or an empty vector if not in the order */
+    std::vector<T> successors(const T& node) const {
+        auto it = m_entries.find(node);
+        if (it == m_entries.end())
+            return {};
+        return it->second.successors;
+    }
+
+
+    /** @return all edges that would close a cycle if added to the order, in order of adding */
+    const std::vector<std::pair<T, T>>& cyclic_edges() const { return m_cyclic; }
+
+
+    /** Calls `f(node)` for every node, in order */
+    template<typename Function>
+    void for_each(Function&& f) const {
+        for (const auto& node: m_order) {
+            if (node)
+                f(*node);
+        }
+    }
+
+
+    std::size_t size() const { return m_entries.size(); }
+
+
+    bool empty() const { return m_entries.empty(); }
+
+private:
+    struct Entry {
+        std::size_t position;
+        std::vector<T> successors;
+        std::vector<T> predecessors;
+    };
+
+
+    static bool erase_one(std::vector<T>& nodes, const T& node) {
+        auto it = std::find(nodes.begin(), nodes.end(), node);
+        if (it == nodes.end())
+            return false;
+
+        nodes.erase(it);
+        return true;
+    }
+
+
+    /**
+     * Moves `to` and everything that must succeed it behind `from` and everything that must precede it, given that
+     * `to` currently is positioned before `from`. Only nodes positioned within [position(to), position(from)] are
+     * visited, and their positions are reused among themselves.
+     *
+     * @return false without modifying the order if `to` already precedes `from`, i.e. if the edge would close a cycle
+     */
+    bool reorder(const T& from, const T& to) {
+        auto lower_bound = m_entries.at(to).position;
+        auto upper_bound = m_entries.at(from).position;
+
+        // everything reachable from `to` that currently is positioned no later than `from`
+        auto forward = visit(to, upper_bound, [](const Entry& e) -> const std::vector<T>& { return e.successors; }
+                             , [upper_bound](std::size_t position) { return position <= upper_bound; });
+        if (!forward)
+            return false;
+
+        // everything reaching `from` that currently is positioned no earlier than `to`
+        auto backward = visit(from, lower_bound, [](const Entry& e) -> const std::vector<T>& { return e.predecessors; }
+                              , [lower_bound](std::size_t position) { return position >= lower_bound; });
+
+        auto by_position = [this](const T& a, const T& b) {
+            return m_entries.at(a).position < m_entries.at(b).position;
+        };
+        std::sort(forward->begin(), forward->end(), by_position);
+        std::sort(backward->begin(), backward->end(), by_position);
+
+        std::vector<std::size_t> positions;
+        positions.reserve(forward->size() + backward->size());
+        for (const auto& node: *backward) {
+            positions.push_back(m_entries.at(node).position);
+        }
+        for (const auto& node: *forward) {
+            positions.push_back(m_entries.at(node).position);
+        }
+        std::sort(positions.begin(), positions.end());
+
+        // the backward set keeps preceding the forward set, each keeping its internal order
+        std::size_t i = 0;
+        for (const auto* nodes: {&*backward, &*forward}) {
+            for (const auto& node: *nodes) {
+                m_entries.at(node).position = positions[i];
+                m_order[positions[i]] = node;
+                ++i;
+            }
+        }
+
+        return true;
+    }
+
+
+    /**
+     * Depth-first search from `start` along the edges returned by `edges`, only entering nodes whose position
+     * satisfies `in_bounds`.
+     *
+     * @return all visited nodes, or std::nullopt if a node at position `stop_at` was reached (other than `start`)
+     */
+    template<typename Edges, typename InBounds>
+    std::optional<std::vector<T>> visit(const T& start, std::size_t stop_at, Edges edges, InBounds in_bounds) const {
+        std::unordered_set<T, Hash> visited{start};
+        std::vector<T> nodes{start};
+        std::vector<T> stack{start};
+
+        while (!stack.empty()) {
+            auto node = stack.back();
+            stack.pop_back();
+
+            for (const auto& next: edges(m_entries.at(node))) {
+                auto position = m_entries.at(next).position;
+                if (position == stop_at)
+                    return std::nullopt;
+
+                if (in_bounds(position) && visited.insert(next).second) {
+                    nodes.push_back(next);
+                    stack.push_back(next);
+                }
+            }
+        }
+
+        return nodes;
+    }
+
+
+    void retry_cyclic_edges() {
+        if (m_cyclic.empty())
+            return;
+
+        auto cyclic = std::move(m_cyclic);
+        m_cyclic.clear();
+
+        for (const auto& [from, to]: cyclic) {
+            add_edge(from, to);
+        }
+    }
+
+
+    /** Removes all gaps left by erased nodes from `m_order` */
+    void compact() {
+        std::size_t position = 0;
+        for (auto& node: m_order) {
+            if (node) {
+                m_entries.at(*node).position = position;
+                m_order[position] = std::move(node);
+                ++position;
+            }
+        }
+
+        m_order.resize(position);
+        m_num_erased = 0;
+    }
+
+
+    std::unordered_map<T, Entry, Hash> m_entries;
+
+    // node at each position, or std::nullopt where a node has been erased
+    std::vector<std::optional<T>> m_order;
+    std::size_t m_num_erased = 0;
+
+    std::vector<std::pair<T, T>> m_cyclic;
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_TOPOLOGICAL_ORDER_H
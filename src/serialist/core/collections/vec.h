@@ -8,7 +8,9 @@
 #include <iomanip>
 #include <sstream>
 #include <numeric>
+#include "core/collections/small_vector.h"
 #include "core/utility/math.h"
+#include "core/utility/simd.h"
 #include "core/utility/traits.h"
 
 
@@ -18,16 +20,29 @@ class Vec {
 public:
     // =========================== CONSTRUCTORS ==========================
 
+    /**
+     * Number of elements stored without heap allocation. Most Vecs in a graph are single voices of a few small
+     * elements (e.g. a Facet or a couple of Triggers), while Vecs of larger elements (e.g. the Voices of a Voices<T>)
+     * typically hold one entry per voice, which isn't worth storing inline
+     */
+    static constexpr std::size_t INLINE_CAPACITY = sizeof(T) <= 32 ? 4 : 0;
+
     using value_type = T;
     using size_type = std::size_t;
     using allocator_type = std::allocator<T>;
-    using iterator = typename std::vector<T>::iterator;
-    using const_iterator = typename std::vector<T>::const_iterator;
+    using storage_type = SmallVector<T, INLINE_CAPACITY>;
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+
+    /** Distinguishes callables from values in overloads taking either (e.g. `contains`, `index`, `remove`) */
+    template<typename F>
+    static constexpr bool is_predicate_v = std::is_invocable_r_v<bool, F&, const T&>;
 
     Vec() = default;
 
 
-    explicit Vec(std::vector<T> data) : m_vector(std::move(data)) {
+    explicit Vec(std::vector<T> data)
+            : m_vector(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end())) {
         // TODO: For now. Ideally, Vec's copy ctor should be deleted to avoid accidental copies
         //        static_assert(std::is_copy_constructible_v<T>, "T must be copy constructible");
     }
@@ -62,14 +77,14 @@ public:
     template<typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     static Vec<T> range(T begin, T end, T step = static_cast<T>(1)) {
         // TODO: ensure begin <= end, etc.
-        std::vector<T> output;
+        Vec<T> output;
         T v = begin;
 
         while (v < end) {
-            output.push_back(v);
+            output.append(v);
             v += step;
         }
-        return Vec<T>{output};
+        return output;
     }
 
 
@@ -103,19 +118,19 @@ public:
 
 
     static Vec<T> repeated(std::size_t repetitions, const T& value) {
-        std::vector<T> output(repetitions, value);
-        return Vec<T>{output};
+        Vec<T> output;
+        output.m_vector.assign(repetitions, value);
+        return output;
     }
 
 
     static Vec<T> repeated(std::size_t repetitions, const Vec<T>& values) {
-        std::vector<T> output;
-        output.reserve(values.size() * repetitions);
+        auto output = Vec<T>::allocated(values.size() * repetitions);
 
         for (std::size_t i = 0; i < repetitions; ++i) {
-            output.insert(output.end(), values.m_vector.begin(), values.m_vector.end());
+            output.m_vector.insert(output.m_vector.end(), values.m_vector.begin(), values.m_vector.end());
         }
-        return Vec<T>(std::move(output));
+        return output;
     }
 
 
@@ -320,13 +335,12 @@ public:
 
     template<typename U>
     Vec<T> operator[](const Vec<U>& indices) const {
-        std::vector<T> result;
-        result.reserve(indices.size());
+        auto result = Vec<T>::allocated(indices.size());
 
         for (auto index: indices) {
-            result.push_back(m_vector.at(sign_index(index)));
+            result.append(m_vector.at(sign_index(index)));
         }
-        return Vec<T>(std::move(result));
+        return result;
     }
 
 
@@ -360,7 +374,7 @@ public:
 
 
     Vec<T> cloned() const {
-        return Vec<T>(m_vector);
+        return *this;
     }
 
 
@@ -368,45 +382,43 @@ public:
         std::size_t start_idx = sign_index(start);
         std::size_t end_idx = sign_index(end);
 
-        std::vector<T> output;
-        output.reserve(end_idx - start_idx);
+        auto output = Vec<T>::allocated(end_idx - start_idx);
         for (std::size_t i = start_idx; i < end_idx; ++i) {
-            output.push_back(m_vector[i]);
+            output.append(m_vector[i]);
         }
 
-        return Vec<T>(std::move(output));
+        return output;
     }
 
 
     Vec<T> drain() {
-        std::vector<T> v;
-        std::swap(m_vector, v);
-        return Vec<T>(std::move(v));
+        Vec<T> output;
+        output.m_vector = std::move(m_vector);
+        m_vector.clear();
+        return output;
     }
 
 
     template<typename U>
     Vec<U> as_type() const {
-        std::vector<U> output;
-        output.reserve(m_vector.size());
+        auto output = Vec<U>::allocated(m_vector.size());
         for (const T& element: m_vector) {
-            output.push_back(static_cast<U>(element));
+            output.append(static_cast<U>(element));
         }
-        return Vec<U>(std::move(output));
+        return output;
     }
 
 
     /**
      * note: requires explicit template argument to be called, cannot be inferred from `f`
      */
-    template<typename U>
-    Vec<U> as_type(std::function<U(const T&)> f) const {
-        std::vector<U> output;
-        output.reserve(m_vector.size());
+    template<typename U, typename Function>
+    Vec<U> as_type(Function&& f) const {
+        auto output = Vec<U>::allocated(m_vector.size());
         for (const T& element: m_vector) {
-            output.push_back(f(element));
+            output.append(f(element));
         }
-        return Vec<U>(std::move(output));
+        return output;
     }
 
 
@@ -529,7 +541,8 @@ public:
     }
 
 
-    Vec<T>& remove(std::function<bool(const T&)> pred) {
+    template<typename Predicate, typename = std::enable_if_t<is_predicate_v<Predicate> > >
+    Vec<T>& remove(Predicate&& pred) {
         if (auto it = std::find_if(m_vector.begin(), m_vector.end(), pred); it != m_vector.end()) {
             m_vector.erase(it);
         }
@@ -557,7 +570,8 @@ public:
     }
 
 
-    std::optional<T> pop_value(std::function<bool(const T&)> pred) {
+    template<typename Predicate, typename = std::enable_if_t<is_predicate_v<Predicate> > >
+    std::optional<T> pop_value(Predicate&& pred) {
         if (auto it = std::find_if(m_vector.begin(), m_vector.end(), pred); it != m_vector.end()) {
             return pop_internal(it);
         }
@@ -710,7 +724,8 @@ public:
     // =========================== FUNCTIONAL ==========================
 
 
-    Vec<T>& map(std::function<T(T)> f) {
+    template<typename Function>
+    Vec<T>& map(Function&& f) {
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
             m_vector[i] = f(m_vector[i]);
         }
@@ -721,15 +736,17 @@ public:
     /**
      *  Removes all elements for which `f` returns false
      */
-    Vec<T>& filter(std::function<bool(T)> f) {
-        m_vector.erase(std::remove_if(m_vector.begin(), m_vector.end(), [f](const T& element) {
+    template<typename Predicate>
+    Vec<T>& filter(Predicate&& f) {
+        m_vector.erase(std::remove_if(m_vector.begin(), m_vector.end(), [&f](const T& element) {
             return !f(element);
         }), m_vector.end());
         return *this;
     }
 
 
-    Vec<T>& apply(std::function<T(T, T)> f, T value) {
+    template<typename Function>
+    Vec<T>& apply(Function&& f, T value) {
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
             m_vector[i] = f(m_vector[i], value);
         }
@@ -737,7 +754,8 @@ public:
     }
 
 
-    Vec<T>& apply(std::function<T(T, T)> f, const Vec<T>& values) {
+    template<typename Function>
+    Vec<T>& apply(Function&& f, const Vec<T>& values) {
         if (values.size() != m_vector.size()) {
             throw std::logic_error("Cannot apply function to vectors of different sizes");
         }
@@ -749,8 +767,8 @@ public:
     }
 
 
-    template<typename SizeType>
-    Vec<T>& apply(std::function<T(T, T)> f, const Vec<T>& values, const Vec<SizeType>& indices) {
+    template<typename Function, typename SizeType>
+    Vec<T>& apply(Function&& f, const Vec<T>& values, const Vec<SizeType>& indices) {
         if (values.size() != indices.size()) {
             throw std::logic_error("values and indices must have the same size");
         }
@@ -771,7 +789,8 @@ public:
     }
 
 
-    Vec<T>& apply(std::function<T(const T&, const T&)> f, const T& value, const Vec<bool>& binary_mask) {
+    template<typename Function>
+    Vec<T>& apply(Function&& f, const T& value, const Vec<bool>& binary_mask) {
         if (m_vector.size() != binary_mask.size()) {
             throw std::logic_error("binary_mask must have the same size as the internal vector");
         }
@@ -785,7 +804,8 @@ public:
     }
 
 
-    Vec<T>& apply(std::function<T(T, T)> f, const Vec<T>& values, const Vec<bool>& binary_mask) {
+    template<typename Function>
+    Vec<T>& apply(Function&& f, const Vec<T>& values, const Vec<bool>& binary_mask) {
         if (m_vector.size() != binary_mask.size()) {
             throw std::logic_error("binary_mask must have the same size as the internal vector");
         }
@@ -820,11 +840,11 @@ public:
         }
 
         if (static_cast<std::size_t>(std::abs(amount)) >= m_vector.size()) {
-            m_vector = std::vector<T>(m_vector.size(), static_cast<T>(0));
+            m_vector.assign(m_vector.size(), static_cast<T>(0));
             return *this;
         }
 
-        std::vector<T> target(m_vector.size(), static_cast<T>(0));
+        storage_type target(m_vector.size(), static_cast<T>(0));
         if (amount > 0) {
             auto target_offset = static_cast<std::size_t>(amount);
             for (std::size_t i = 0; i < target.size() - target_offset; ++i) {
@@ -837,13 +857,14 @@ public:
             }
         }
 
-        m_vector = target;
+        m_vector = std::move(target);
 
         return *this;
     }
 
 
-    T foldl(std::function<T(T, T)> f, const T& initial) const {
+    template<typename Function>
+    T foldl(Function&& f, const T& initial) const {
         T value = initial;
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
             value = f(value, m_vector[i]);
@@ -852,13 +873,14 @@ public:
     }
 
 
-    decltype(auto) count(std::function<bool(T)> f) const {
+    template<typename Predicate>
+    decltype(auto) count(Predicate&& f) const {
         return std::count_if(m_vector.begin(), m_vector.end(), f);
     }
 
 
-    template<typename E = T, typename = std::enable_if_t<!std::is_same_v<E, bool>> >
-    bool all(std::function<bool(T)> f) const {
+    template<typename Predicate, typename E = T, typename = std::enable_if_t<!std::is_same_v<E, bool>> >
+    bool all(Predicate&& f) const {
         return std::all_of(m_vector.begin(), m_vector.end(), f);
     }
 
@@ -869,8 +891,8 @@ public:
     }
 
 
-    template<typename E = T, typename = std::enable_if_t<!std::is_same_v<E, bool>> >
-    bool any(std::function<bool(T)> f) const {
+    template<typename Predicate, typename E = T, typename = std::enable_if_t<!std::is_same_v<E, bool>> >
+    bool any(Predicate&& f) const {
         return std::any_of(m_vector.begin(), m_vector.end(), f);
     }
 
@@ -882,19 +904,37 @@ public:
 
 
     /**
-     * Removes all elements for which `f` returns false from the original Vec and returns them as a separate vector
+     * Removes all elements for which `f` returns false from the original Vec and returns them as a separate vector.
+     * Both keep their relative order. Unlike std::stable_partition, this never allocates a temporary buffer: the
+     * drained elements are counted first, and then moved into a vector allocated once (see `SmallVector`).
+     *
+     * @note `f` may be called twice for the same element and should therefore not have any side effects
      */
-    Vec<T> filter_drain(std::function<bool(const T&)> f) {
-        auto drain_iterator = std::stable_partition(m_vector.begin(), m_vector.end(), f);
+    template<typename Predicate>
+    Vec<T> filter_drain(Predicate&& f) {
+        auto first_drained = std::find_if_not(m_vector.begin(), m_vector.end(), f);
+        if (first_drained == m_vector.end())
+            return {};
+
+        auto num_drained = static_cast<std::size_t>(std::count_if(first_drained, m_vector.end(), [&f](const T& e) {
+            return !f(e);
+        }));
 
-        std::vector<T> drained;
+        Vec<T> drained;
+        drained.m_vector.reserve(num_drained);
 
-        for (auto it = drain_iterator; it != m_vector.end(); ++it) {
-            drained.push_back(std::move(*it));
+        auto kept_end = first_drained;
+        for (auto it = first_drained; it != m_vector.end(); ++it) {
+            if (f(*it)) {
+                *kept_end = std::move(*it);
+                ++kept_end;
+            } else {
+                drained.m_vector.emplace_back(std::move(*it));
+            }
         }
 
-        m_vector.erase(drain_iterator, m_vector.end());
-        return Vec<T>(std::move(drained));
+        m_vector.erase(kept_end, m_vector.end());
+        return drained;
     }
 
 
@@ -959,7 +999,8 @@ public:
         return m_vector.size();
     }
 
-    std::optional<std::reference_wrapper<const T>> find(std::function<bool(const T&)> f) const {
+    template<typename Predicate>
+    std::optional<std::reference_wrapper<const T>> find(Predicate&& f) const {
         for (const T& element: m_vector) {
             if (f(element)) {
                 return element;
@@ -969,7 +1010,8 @@ public:
     }
 
 
-    std::optional<std::reference_wrapper<T>> find(std::function<bool(const T&)> f){
+    template<typename Predicate>
+    std::optional<std::reference_wrapper<T>> find(Predicate&& f) {
         for (T& element: m_vector) {
             if (f(element)) {
                 return element;
@@ -998,7 +1040,8 @@ public:
     }
 
 
-    bool contains(std::function<bool(const T&)> f) const {
+    template<typename Predicate, typename = std::enable_if_t<is_predicate_v<Predicate> > >
+    bool contains(Predicate&& f) const {
         for (const T& element: m_vector) {
             if (f(element)) {
                 return true;
@@ -1017,7 +1060,8 @@ public:
     }
 
 
-    std::optional<std::size_t> index(std::function<bool(const T&)> f) const {
+    template<typename Predicate, typename = std::enable_if_t<is_predicate_v<Predicate> > >
+    std::optional<std::size_t> index(Predicate&& f) const {
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
             if (f(m_vector[i])) {
                 return i;
@@ -1027,7 +1071,8 @@ public:
     }
 
 
-    Vec<std::size_t> argwhere(std::function<bool(const T&)> f) const {
+    template<typename Predicate>
+    Vec<std::size_t> argwhere(Predicate&& f) const {
         Vec<std::size_t> indices;
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
             if (f(m_vector[i])) {
@@ -1058,12 +1103,19 @@ public:
     }
 
 
-    const std::vector<T>& vector() const {
+    /** @return the underlying storage, which only provides a subset of the std::vector interface (see `SmallVector`) */
+    const storage_type& vector() const {
         return m_vector;
     }
 
 
-    std::vector<T>& vector_mut() {
+    /** @return a copy of all elements, for interfaces that require a std::vector */
+    std::vector<T> to_std_vector() const {
+        return std::vector<T>(m_vector.begin(), m_vector.end());
+    }
+
+
+    storage_type& vector_mut() {
         return m_vector;
     }
 
@@ -1099,28 +1151,28 @@ public:
 
     template<typename... Args, typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     Vec<T>& add(Args... args) {
-        apply_base(std::plus<T>(), args...);
+        arithmetic([](auto... operands) { simd::add(operands...); }, std::plus<T>(), args...);
         return *this;
     }
 
 
     template<typename... Args, typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     Vec<T>& subtract(Args... args) {
-        apply_base(std::minus<T>(), args...);
+        arithmetic([](auto... operands) { simd::subtract(operands...); }, std::minus<T>(), args...);
         return *this;
     }
 
 
     template<typename... Args, typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     Vec<T>& multiply(Args... args) {
-        apply_base(std::multiplies<T>(), args...);
+        arithmetic([](auto... operands) { simd::multiply(operands...); }, std::multiplies<T>(), args...);
         return *this;
     }
 
 
     template<typename... Args, typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     Vec<T>& divide(Args... args) {
-        apply_base(std::divides<T>(), args...);
+        arithmetic([](auto... operands) { simd::divide(operands...); }, std::divides<T>(), args...);
         return *this;
     }
 
@@ -1137,8 +1189,12 @@ public:
         if (auto max_value = max(); max_value != static_cast<T>(0.0)) {
             auto scale_factor = 1 / max_value;
 
-            for (auto& e: m_vector) {
-                e *= scale_factor;
+            if constexpr (utils::is_double_like_v<T>) {
+                simd::multiply(double_data(), m_vector.size(), static_cast<double>(scale_factor));
+            } else {
+                for (auto& e: m_vector) {
+                    e *= scale_factor;
+                }
             }
         }
         return *this;
@@ -1147,6 +1203,13 @@ public:
 
     template<typename E = T, typename = std::enable_if_t<std::is_floating_point_v<E> > >
     Vec<T>& normalize_l1() {
+        if constexpr (utils::is_double_like_v<T>) {
+            if (auto sum = simd::sum_abs(double_data(), m_vector.size()); sum != 0.0) {
+                simd::multiply(double_data(), m_vector.size(), 1.0 / sum);
+            }
+            return *this;
+        }
+
         auto sum = static_cast<T>(0.0);
         for (const auto& e: m_vector) {
             sum += std::abs(e);
@@ -1165,6 +1228,13 @@ public:
 
     template<typename E = T, typename = std::enable_if_t<std::is_floating_point_v<E> > >
     Vec<T>& normalize_l2() {
+        if constexpr (utils::is_double_like_v<T>) {
+            if (auto sum_of_squares = simd::sum_squares(double_data(), m_vector.size()); sum_of_squares != 0.0) {
+                simd::multiply(double_data(), m_vector.size(), std::sqrt(1.0 / sum_of_squares));
+            }
+            return *this;
+        }
+
         auto sum_of_squares = static_cast<T>(0.0);
         for (const auto& e: m_vector) {
             sum_of_squares += e * e;
@@ -1183,6 +1253,11 @@ public:
 
     template<typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     Vec<T>& min_of(const T& value) {
+        if constexpr (utils::is_double_like_v<T>) {
+            simd::min_of(double_data(), m_vector.size(), static_cast<double>(value));
+            return *this;
+        }
+
         for (auto& e: m_vector) {
             e = std::min(e, value);
         }
@@ -1192,6 +1267,11 @@ public:
 
     template<typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     Vec<T>& max_of(const T& value) {
+        if constexpr (utils::is_double_like_v<T>) {
+            simd::max_of(double_data(), m_vector.size(), static_cast<double>(value));
+            return *this;
+        }
+
         for (auto& e: m_vector) {
             e = std::max(e, value);
         }
@@ -1274,7 +1354,7 @@ public:
             throw std::out_of_range("indices.size() != m_vector.size()");
         }
 
-        std::vector<T> reordered(m_vector.size());
+        storage_type reordered(m_vector.size());
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
             reordered[i] = m_vector[indices[i]];
         }
@@ -1285,18 +1365,16 @@ public:
 
 
     Vec<std::size_t> argsort(bool ascending = true, bool apply_sort = false) {
-        std::vector<std::size_t> indices(m_vector.size());
-        std::iota(indices.begin(), indices.end(), 0);
+        auto output = Vec<std::size_t>::repeated(m_vector.size(), 0);
+        std::iota(output.begin(), output.end(), 0);
 
         if (ascending)
-            std::sort(indices.begin(), indices.end()
+            std::sort(output.begin(), output.end()
                       , [this](std::size_t i, std::size_t j) { return m_vector[i] < m_vector[j]; });
         else
-            std::sort(indices.begin(), indices.end()
+            std::sort(output.begin(), output.end()
                       , [this](std::size_t i, std::size_t j) { return m_vector[i] > m_vector[j]; });
 
-        auto output = Vec<std::size_t>(std::move(indices));
-
         if (apply_sort) {
             reorder(output);
         }
@@ -1312,6 +1390,9 @@ public:
 
     template<typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     T sum() const {
+        if constexpr (utils::is_double_like_v<T>) {
+            return T(simd::sum(double_data(), m_vector.size()));
+        }
         return std::accumulate(m_vector.begin(), m_vector.end(), T(0));
     }
 
@@ -1334,12 +1415,18 @@ public:
 
     template<typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     T max() const {
+        if constexpr (utils::is_double_like_v<T>) {
+            return T(simd::max(double_data(), m_vector.size()));
+        }
         return *std::max_element(m_vector.begin(), m_vector.end());
     }
 
 
     template<typename E = T, typename = std::enable_if_t<std::is_arithmetic_v<E> > >
     T min() const {
+        if constexpr (utils::is_double_like_v<T>) {
+            return T(simd::min(double_data(), m_vector.size()));
+        }
         return *std::min_element(m_vector.begin(), m_vector.end());
     }
 
@@ -1452,45 +1539,85 @@ private:
     template<typename SizeType, typename = std::enable_if_t<
                  std::is_integral_v<SizeType> && std::is_signed_v<SizeType>> >
     Vec<std::size_t> sign_indices(const Vec<SizeType>& indices) const {
-        std::vector<std::size_t> result;
-        result.reserve(indices.size());
-        for (auto index: indices.vector()) {
-            result.push_back(sign_index(index));
+        auto result = Vec<std::size_t>::allocated(indices.size());
+        for (auto index: indices) {
+            result.append(sign_index(index));
         }
-        return Vec<std::size_t>(std::move(result));
+        return result;
     }
 
 
-    Vec<T> elementwise_operation(const T& operand2, std::function<T(T, T)> op) const {
-        std::vector<T> output;
-        output.reserve(m_vector.size());
+    template<typename Function>
+    Vec<T> elementwise_operation(const T& operand2, Function&& op) const {
+        auto output = Vec<T>::allocated(m_vector.size());
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
-            output.push_back(op(m_vector.at(i), operand2));
+            output.append(op(m_vector.at(i), operand2));
         }
-        return Vec<T>(std::move(output));
+        return output;
     }
 
 
-    Vec<T> elementwise_operation(const Vec<T>& other, std::function<T(T, T)> op) const {
+    template<typename Function>
+    Vec<T> elementwise_operation(const Vec<T>& other, Function&& op) const {
         if (m_vector.size() != other.m_vector.size()) {
             throw std::out_of_range("vectors must have the same size for element-wise operation");
         }
 
-        std::vector<T> output;
-        output.reserve(m_vector.size());
+        auto output = Vec<T>::allocated(m_vector.size());
         for (std::size_t i = 0; i < m_vector.size(); ++i) {
-            output.push_back(op(m_vector.at(i), other.m_vector.at(i)));
+            output.append(op(m_vector.at(i), other.m_vector.at(i)));
         }
-        return Vec<T>(std::move(output));
+        return output;
     }
 
 
-    template<typename... Args>
-    void apply_base(std::function<T(T, T)> f, Args... args) {
+    template<typename Function, typename... Args>
+    void apply_base(Function&& f, Args... args) {
         apply(f, args...);
     }
 
 
+    /**
+     * Applies an element-wise operation with a single scalar or Vec operand using `kernel` (see `simd.h`)
+     * for Vecs of doubles, and with `f` (see `apply`) otherwise
+     */
+    template<typename Kernel, typename Function, typename... Args>
+    void arithmetic(Kernel&& kernel, Function&& f, Args... args) {
+        if constexpr (utils::is_double_like_v<T> && sizeof...(Args) == 1) {
+            vectorized(kernel, args...);
+        } else {
+            apply_base(f, args...);
+        }
+    }
+
+
+    template<typename Kernel>
+    void vectorized(Kernel&& kernel, const Vec<T>& values) {
+        if (values.size() != m_vector.size()) {
+            throw std::logic_error("Cannot apply function to vectors of different sizes");
+        }
+        kernel(double_data(), values.double_data(), m_vector.size());
+    }
+
+
+    template<typename Kernel, typename U>
+    void vectorized(Kernel&& kernel, const U& value) {
+        kernel(double_data(), m_vector.size(), static_cast<double>(value));
+    }
+
+
+    double* double_data() {
+        static_assert(utils::is_double_like_v<T>);
+        return reinterpret_cast<double*>(m_vector.data());
+    }
+
+
+    const double* double_data() const {
+        static_assert(utils::is_double_like_v<T>);
+        return reinterpret_cast<const double*>(m_vector.data());
+    }
+
+
     enum class ResizeType {
         append, extend, fold, default_ctor
     };
@@ -1514,14 +1641,14 @@ private:
     }
 
 
-    std::optional<T> pop_internal(typename std::vector<T>::iterator it) {
+    std::optional<T> pop_internal(iterator it) {
         auto output = std::make_optional<T>(std::move(*it));
         m_vector.erase(it);
         return std::move(output);
     }
 
 
-    std::vector<T> m_vector;
+    storage_type m_vector;
 };
 } // namespace serialist
 
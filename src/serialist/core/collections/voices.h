@@ -1,12 +1,15 @@
 #ifndef SERIALISTLOOPER_VOICES_H
 #define SERIALISTLOOPER_VOICES_H
 
+#include <memory>
+#include <memory_resource>
 #include <vector>
 #include <optional>
 #include <iostream>
 #include <iomanip>
 #include "core/utility/enums.h"
 #include "core/utility/traits.h"
+#include "core/utility/cycle_arena.h"
 #include "core/collections/vec.h"
 
 
@@ -25,8 +28,8 @@ public:
     using value_type = T;
     using size_type = std::size_t;
     using allocator_type = std::allocator<T>;
-    using iterator = typename std::vector<T>::iterator;
-    using const_iterator = typename std::vector<T>::const_iterator;
+    using iterator = typename Vec<Voice<T> >::iterator;
+    using const_iterator = typename Vec<Voice<T> >::const_iterator;
 
     template<typename U>
     struct is_voices_like : std::disjunction<
@@ -157,6 +160,15 @@ public:
     }
 
 
+    /**
+     * @return the Voice at `index` of this Voices adapted to any number of voices greater than `index`
+     *         (see `adapted_to`), without copying it
+     */
+    const Voice<T>& adapted_at(std::size_t index) const {
+        return m_voices[index % m_voices.size()];
+    }
+
+
     decltype(auto) begin() { return m_voices.begin(); }
 
 
@@ -178,29 +190,25 @@ public:
 
     template<typename U = T>
     Voices<U> as_type() const {
-        std::vector<Voice<U> > output;
-        output.reserve(m_voices.size());
+        auto output = Vec<Voice<U> >::allocated(m_voices.size());
 
-        for (const auto& voice: m_voices.vector()) {
-            output.push_back(voice.template as_type<U>());
+        for (const auto& voice: m_voices) {
+            output.append(voice.template as_type<U>());
         }
 
-        auto vec = Vec<Voice<U> >(std::move(output));
-        return Voices<U>(std::move(vec));
+        return Voices<U>(std::move(output));
     }
 
 
-    template<typename U = T>
-    Voices<U> as_type(std::function<U(const T&)> f) const {
-        std::vector<Voice<U> > output;
-        output.reserve(m_voices.size());
+    template<typename U = T, typename Function>
+    Voices<U> as_type(Function&& f) const {
+        auto output = Vec<Voice<U> >::allocated(m_voices.size());
 
-        for (const auto& voice: m_voices.vector()) {
-            output.push_back(voice.template as_type<U>(f));
+        for (const auto& voice: m_voices) {
+            output.append(voice.template as_type<U>(f));
         }
 
-        auto vec = Vec<Voice<U> >(std::move(output));
-        return Voices<U>(std::move(vec));
+        return Voices<U>(std::move(output));
     }
 
 
@@ -292,11 +300,7 @@ public:
         if (m_voices.empty())
             return fallback;
 
-        if (auto voice = m_voices.first(); voice.has_value()) {
-            return (*voice).first_or(fallback);
-        } else {
-            return fallback;
-        }
+        return m_voices[0].template first_or<U>(fallback);
     }
 
 
@@ -305,29 +309,46 @@ public:
     */
     template<typename U = T>
     Vec<std::optional<U> > firsts() const {
-        std::vector<std::optional<U> > output;
-        output.reserve(m_voices.size());
+        auto output = Vec<std::optional<U> >::allocated(m_voices.size());
 
-        auto& v = m_voices.vector();
-        std::transform(v.begin(), v.end(), std::back_inserter(output)
-                       , [](const Voice<T>& voice) { return voice.first(); });
+        for (const auto& voice: m_voices) {
+            output.append(voice.first());
+        }
 
-        return Vec<std::optional<U> >(std::move(output));
+        return output;
     }
 
 
     template<typename U = T>
     Vec<U> firsts_or(const U& fallback) const {
-        std::vector<U> output;
-        output.reserve(m_voices.size());
+        auto output = Vec<U>::allocated(m_voices.size());
+
+        for (const auto& voice: m_voices) {
+            output.append(voice.first_or(fallback));
+        }
 
-        auto v = m_voices.vector();
-        std::transform(v.begin(), v.end(), std::back_inserter(output)
-                       , [&fallback](const Voice<T>& voice) { return voice.first_or(fallback); });
+        return output;
+    }
 
-        return Vec<U>(std::move(output));
+    /**
+     * @return `firsts()` of this Voices adapted to `target_num_voices` (see `adapted_to`), without copying any Voice
+     */
+    template<typename U = T>
+    Vec<std::optional<U> > adapted_firsts(std::size_t target_num_voices) const {
+        return adapted_vec(firsts<U>(), target_num_voices);
     }
 
+
+    /**
+     * @return `firsts_or(fallback)` of this Voices adapted to `target_num_voices` (see `adapted_to`), without
+     *         copying any Voice
+     */
+    template<typename U = T>
+    Vec<U> adapted_firsts_or(std::size_t target_num_voices, const U& fallback) const {
+        return adapted_vec(firsts_or<U>(fallback), target_num_voices);
+    }
+
+
     /**
      * @return The entire first Voice<T>, or std::nullopt if no first voice exists (which shouldn't ever be the case)
      */
@@ -370,7 +391,8 @@ public:
     }
 
 
-    std::pair<Voices<T>, Voices<T> > partition(std::function<bool(const T&)> f) const {
+    template<typename Predicate>
+    std::pair<Voices<T>, Voices<T> > partition(Predicate&& f) const {
         Voices<T> matching = Voices<T>::zeros(m_voices.size());
         Voices<T> non_matching = Voices<T>::zeros(m_voices.size());
 
@@ -543,8 +565,38 @@ private:
     }
 
 
+    /** Adapts a Vec with one element per voice to `target_num_voices` in the same way as `adapted_to` */
+    template<typename U>
+    static Vec<U> adapted_vec(Vec<U>&& per_voice, std::size_t target_num_voices) {
+        if (per_voice.size() != target_num_voices && target_num_voices != AUTO_VOICES)
+            per_voice.resize_fold(target_num_voices);
+        return std::move(per_voice);
+    }
+
+
     Vec<Voice<T> > m_voices;
 };
+
+
+/** Immutable output of a node, shared between all consumers of the output within a cycle */
+template<typename T>
+using SharedVoices = std::shared_ptr<const Voices<T>>;
+
+
+/** Allocates a `SharedVoices` (including its control block) from the memory resource of the calling thread */
+template<typename T>
+SharedVoices<T> make_shared_voices(Voices<T>&& voices) {
+    std::pmr::polymorphic_allocator<Voices<T>> allocator{ThreadMemoryResource::get()};
+    return std::allocate_shared<Voices<T>>(allocator, std::move(voices));
+}
+
+
+template<typename T>
+SharedVoices<T> make_shared_voices(const Voices<T>& voices) {
+    std::pmr::polymorphic_allocator<Voices<T>> allocator{ThreadMemoryResource::get()};
+    return std::allocate_shared<Voices<T>>(allocator, voices);
+}
+
 } // namespace serialist
 
 #endif //SERIALISTLOOPER_VOICES_H
@@ -2,10 +2,64 @@
 #ifndef SERIALISTLOOPER_CONNECTABLE_H
 #define SERIALISTLOOPER_CONNECTABLE_H
 
+#include <atomic>
 #include "core/generative.h"
 
 namespace serialist {
 
+/**
+ * @brief Connection from a generative to another generative, as seen by the editing and by the processing thread.
+ *
+ * `connect` changes the `target` immediately, which is what the generative reports through `get_connected`.
+ * By default, the `active` connection, which is what the generative reads while processing, follows immediately.
+ * Once staged (see `GenerationGraph`), the active connection only changes through `apply`, which the owner of the
+ * schedule calls between two cycles, together with a schedule that accounts for the new connection.
+ */
+class ConnectionSlot {
+public:
+    explicit ConnectionSlot(Generative* initial = nullptr) : m_target(initial), m_active(initial) {}
+
+    ConnectionSlot(const ConnectionSlot&) = delete;
+    ConnectionSlot& operator=(const ConnectionSlot&) = delete;
+    ConnectionSlot(ConnectionSlot&&) noexcept = delete;
+    ConnectionSlot& operator=(ConnectionSlot&&) noexcept = delete;
+
+
+    /** @return the latest connection, including connections not yet applied */
+    Generative* target() const { return m_target.load(std::memory_order_acquire); }
+
+
+    /** @return the connection to read while processing */
+    Generative* active() const { return m_active.load(std::memory_order_acquire); }
+
+
+    void connect(Generative* generative) {
+        m_target.store(generative, std::memory_order_release);
+        if (!m_staged.load(std::memory_order_acquire))
+            m_active.store(generative, std::memory_order_release);
+    }
+
+
+    /** Defers changes of the active connection to `apply`, or applies the latest connection again if false */
+    void set_staged(bool staged) {
+        m_staged.store(staged, std::memory_order_release);
+        if (!staged)
+            m_active.store(target(), std::memory_order_release);
+    }
+
+
+    /** Must only be called by the processing thread, with a `target` this slot has had */
+    void apply(Generative* generative) { m_active.store(generative, std::memory_order_release); }
+
+private:
+    std::atomic<Generative*> m_target;
+    std::atomic<Generative*> m_active;
+    std::atomic<bool> m_staged{false};
+};
+
+
+// ==============================================================================================
+
 class Connectable {
 public:
     Connectable() = default;
@@ -25,6 +79,8 @@ public:
 
     virtual void disconnect_if(Generative& connected_to) = 0;
 
+    virtual ConnectionSlot& get_connection_slot() = 0;
+
 
 //    template<typename... Args>
 //    static std::vector<Connectable*> collect_connectable(Args* ... args) {
@@ -3,124 +3,268 @@
 #ifndef SERIALISTLOOPER_GENERATION_GRAPH_H
 #define SERIALISTLOOPER_GENERATION_GRAPH_H
 
+#include <atomic>
+#include <limits>
 #include <mutex>
-#include <regex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include "core/connectable.h"
 #include "core/generative.h"
+#include "core/collections/identifier_index.h"
+#include "core/collections/topological_order.h"
 #include "serialist/core/policies/policies.h"
+#include "core/param/parameter_change_queue.h"
 #include "core/param/parameter_keys.h"
+#include "core/temporal/time_gate.h"
 #include "core/types/time_point.h"
+#include "core/utility/cycle_arena.h"
+#include "core/utility/thread_pool.h"
 
 namespace serialist {
 
 class GraphUtils {
 public:
-    using IndexGraph = std::unordered_map<std::size_t, std::vector<std::size_t>>;
+    using IndexGraph = std::vector<std::vector<std::size_t>>;
+    using IndexMap = std::unordered_map<const Generative*, std::size_t>;
 
     GraphUtils() = delete;
 
 
     static std::vector<std::vector<Generative*>> find_cycles(const std::vector<std::unique_ptr<Generative>>& generatives) {
-        auto dependency_graph = compute_dependency_graph(generatives);
+        return find_cycles_through(raw(generatives));
+    }
+
 
-        auto cycles_as_indices = find_circular_dependencies(dependency_graph);
+    /**
+     * @return all generatives in `roots` along with every generative they directly or indirectly depend on
+     */
+    static std::unordered_set<const Generative*> reachable_from(const std::vector<Generative*>& roots) {
+        std::unordered_set<const Generative*> reachable;
+        std::vector<Generative*> stack;
 
-        std::vector<std::vector<Generative*>> cycles_as_generatives;
-        for (auto& cycle: cycles_as_indices) {
-            std::vector<Generative*> generative_cycle;
-            for (auto& index: cycle) {
-                generative_cycle.push_back(generatives.at(index).get());
+        for (auto* root: roots) {
+            if (reachable.insert(root).second)
+                stack.push_back(root);
+        }
+
+        while (!stack.empty()) {
+            auto* generative = stack.back();
+            stack.pop_back();
+
+            for (auto* dependency: generative->get_connected()) {
+                if (reachable.insert(dependency).second)
+                    stack.push_back(dependency);
             }
-            cycles_as_generatives.push_back(generative_cycle);
         }
 
-        return cycles_as_generatives;
+        return reachable;
     }
 
 
-private:
-    static IndexGraph compute_dependency_graph(const std::vector<std::unique_ptr<Generative>>& generatives) {
-        IndexGraph dependency_graph;
+    /**
+     * Incremental cycle detection: only the generatives reachable from `generatives` through their dependencies are
+     * visited, meaning that the cost of validating a newly added generative is proportional to its upstream graph
+     * rather than to the size of the full graph.
+     *
+     * @return cycles that pass through at least one generative in `generatives`. Note that when multiple cycles share
+     *         edges, only a subset of them may be reported, but if any such cycle exists, at least one is returned.
+     */
+    static std::vector<std::vector<Generative*>> find_cycles_through(const std::vector<Generative*>& generatives) {
+        enum class State { in_progress, done };
+
+        std::unordered_set<const Generative*> roots(generatives.begin(), generatives.end());
+        std::unordered_map<const Generative*, State> states;
+        std::vector<std::vector<Generative*>> cycles;
+
+        // iterative DFS: `path` holds the current chain of dependencies, `pending` the unvisited dependencies of each
+        std::vector<Generative*> path;
+        std::vector<std::vector<Generative*>> pending;
+
+        for (auto* root: generatives) {
+            if (states.find(root) != states.end())
+                continue;
+
+            states.emplace(root, State::in_progress);
+            path.push_back(root);
+            pending.push_back(root->get_connected());
+
+            while (!path.empty()) {
+                if (pending.back().empty()) {
+                    states[path.back()] = State::done;
+                    path.pop_back();
+                    pending.pop_back();
+                    continue;
+                }
+
+                auto* dependency = pending.back().back();
+                pending.back().pop_back();
+
+                auto it = states.find(dependency);
+                if (it == states.end()) {
+                    states.emplace(dependency, State::in_progress);
+                    path.push_back(dependency);
+                    pending.push_back(dependency->get_connected());
+
+                } else if (it->second == State::in_progress) {
+                    std::vector<Generative*> cycle(std::find(path.begin(), path.end(), dependency), path.end());
+                    if (std::any_of(cycle.begin(), cycle.end(), [&roots](auto* g) { return roots.count(g) > 0; }))
+                        cycles.emplace_back(std::move(cycle));
+                }
+            }
+        }
 
+        return cycles;
+    }
+
+
+    static IndexMap index_map(const std::vector<Generative*>& generatives) {
+        IndexMap indices;
+        indices.reserve(generatives.size());
         for (std::size_t i = 0; i < generatives.size(); ++i) {
-            auto dependencies = indices_of(generatives.at(i)->get_connected(), generatives);
-            dependency_graph.insert({i, dependencies});
+            indices.emplace(generatives[i], i);
         }
-
-        return dependency_graph;
+        return indices;
     }
 
 
-    static std::vector<std::vector<std::size_t>> find_circular_dependencies(IndexGraph& graph) {
-        std::unordered_map<std::size_t, bool> visited;
-        std::vector<std::vector<std::size_t>> circular_dependencies;
+    /**
+     * @brief Generatives grouped into levels, where each generative only depends on generatives in earlier levels.
+     *        Generatives in the same level are independent of each other and may be evaluated concurrently.
+     */
+    struct Levels {
+        std::vector<std::vector<Generative*>> levels;
 
-        for (const auto& pair: graph) {
-            std::size_t node = pair.first;
-            if (!visited[node]) {
-                std::vector<std::size_t> path;
-                std::vector<std::vector<std::size_t>> cycle = cycles_from(node, graph, visited, path);
-                circular_dependencies.insert(circular_dependencies.end(), cycle.begin(), cycle.end());
-            }
-        }
+        /** Generatives that are part of (or depend on) a cycle, in insertion order. Must be evaluated sequentially */
+        std::vector<Generative*> unordered;
+    };
 
-        return circular_dependencies;
+
+    /**
+     * @return all generatives ordered such that each generative appears after all of its dependencies.
+     *         Generatives that are part of (or depend on) a cycle cannot be ordered, and are appended at the end
+     *         in insertion order.
+     *
+     * @throw std::runtime_error if any generative is connected to a generative that isn't in `generatives`
+     */
+    static std::vector<Generative*> topological_order(const std::vector<std::unique_ptr<Generative>>& generatives) {
+        auto levels = topological_levels(raw(generatives));
+
+        std::vector<Generative*> ordered_generatives;
+        ordered_generatives.reserve(generatives.size());
+        for (const auto& level: levels.levels) {
+            ordered_generatives.insert(ordered_generatives.end(), level.begin(), level.end());
+        }
+        ordered_generatives.insert(ordered_generatives.end(), levels.unordered.begin(), levels.unordered.end());
+        return ordered_generatives;
     }
 
 
     /**
+     * @return all generatives partitioned into dependency levels, see `Levels`
      *
-     * @throw std::runtime_error if `generative` is not in `generatives`
+     * @throw std::runtime_error if any generative is connected to a generative that isn't in `generatives`
      */
-    static std::size_t index_of(Generative& generative, const std::vector<std::unique_ptr<Generative>>& generatives) {
+    static Levels topological_levels(const std::vector<std::unique_ptr<Generative>>& generatives) {
+        return topological_levels(raw(generatives));
+    }
+
+
+    static Levels topological_levels(const std::vector<Generative*>& generatives) {
+        auto dependency_graph = compute_dependency_graph(generatives);
+
+        std::vector<std::size_t> num_dependencies(generatives.size(), 0);
+        IndexGraph dependents(generatives.size());
+        for (std::size_t node = 0; node < generatives.size(); ++node) {
+            const auto& dependencies = dependency_graph[node];
+            num_dependencies[node] = dependencies.size();
+            for (auto dependency: dependencies) {
+                dependents[dependency].push_back(node);
+            }
+        }
+
+        // Kahn's algorithm, using `order` as the queue of nodes whose dependencies all have been scheduled
+        std::vector<std::size_t> order;
+        order.reserve(generatives.size());
         for (std::size_t i = 0; i < generatives.size(); ++i) {
-            if (generatives.at(i).get() == &generative) {
-                return i;
+            if (num_dependencies[i] == 0)
+                order.push_back(i);
+        }
+
+        // level of each node is one above the level of its deepest dependency
+        std::vector<std::size_t> level_of(generatives.size(), 0);
+        for (std::size_t head = 0; head < order.size(); ++head) {
+            auto node = order[head];
+            for (auto dependent: dependents[node]) {
+                level_of[dependent] = std::max(level_of[dependent], level_of[node] + 1);
+                if (--num_dependencies[dependent] == 0)
+                    order.push_back(dependent);
             }
         }
-        throw std::runtime_error("unregistered generative encountered in index_of");
+
+        Levels levels;
+        for (auto index: order) {
+            if (level_of[index] >= levels.levels.size())
+                levels.levels.resize(level_of[index] + 1);
+            levels.levels[level_of[index]].push_back(generatives[index]);
+        }
+
+        if (order.size() < generatives.size()) {
+            for (std::size_t i = 0; i < generatives.size(); ++i) {
+                if (num_dependencies[i] > 0)
+                    levels.unordered.push_back(generatives[i]);
+            }
+        }
+
+        return levels;
+    }
+
+
+private:
+    static std::vector<Generative*> raw(const std::vector<std::unique_ptr<Generative>>& generatives) {
+        std::vector<Generative*> output;
+        output.reserve(generatives.size());
+        for (const auto& generative: generatives) {
+            output.push_back(generative.get());
+        }
+        return output;
     }
 
 
     /**
-     *
-     * @throw std::runtime_error if `generative` is not in `generatives`
+     * @throw std::runtime_error if any generative is connected to a generative that isn't in `generatives`
      */
-    static std::vector<std::size_t> indices_of(const std::vector<Generative*> subset
-                                               , const std::vector<std::unique_ptr<Generative>>& full_set) {
-        std::vector<std::size_t> output;
-        output.reserve(subset.size());
+    static IndexGraph compute_dependency_graph(const std::vector<Generative*>& generatives) {
+        auto indices = index_map(generatives);
 
-        for (auto* generative: subset) {
-            output.emplace_back(index_of(*generative, full_set));
+        IndexGraph dependency_graph;
+        dependency_graph.reserve(generatives.size());
+
+        for (auto* generative: generatives) {
+            dependency_graph.emplace_back(indices_of(generative->get_connected(), indices));
         }
 
-        return output;
+        return dependency_graph;
     }
 
 
-    static std::vector<std::vector<std::size_t>> cycles_from(std::size_t node
-                                                      , IndexGraph& graph
-                                                      , std::unordered_map<std::size_t, bool>& visited
-                                                      , std::vector<std::size_t>& path) {
-        visited[node] = true;
-        path.push_back(node);
+    /**
+     * @throw std::runtime_error if any generative in `subset` is not in `indices`
+     */
+    static std::vector<std::size_t> indices_of(const std::vector<Generative*>& subset, const IndexMap& indices) {
+        std::vector<std::size_t> output;
+        output.reserve(subset.size());
+
+        for (auto* generative: subset) {
+            auto it = indices.find(generative);
+            if (it == indices.end())
+                throw std::runtime_error("unregistered generative encountered in indices_of");
 
-        std::vector<std::vector<std::size_t>> cycles;
-        for (std::size_t neighbor: graph[node]) {
-            if (!visited[neighbor]) {
-                std::vector<std::vector<std::size_t>> cycle = cycles_from(neighbor, graph, visited, path);
-                cycles.insert(cycles.end(), cycle.begin(), cycle.end());
-            } else if (std::find(path.begin(), path.end(), neighbor) != path.end()) {
-                auto cycle_start = std::find(path.begin(), path.end(), neighbor) - path.begin();
-                std::vector<std::size_t> cycle(path.begin() + cycle_start, path.end());
-                cycles.push_back(cycle);
-            }
+            output.emplace_back(it->second);
         }
 
-        path.pop_back();
-        return cycles;
+        return output;
     }
-
 };
 
 
@@ -132,17 +276,81 @@ public:
 
 
     explicit GenerationGraph(ParameterHandler& root)
-            : m_parameter_handler("", root, param::types::generatives_tree) {}
+            : m_parameter_handler(Specification(param::types::generatives_tree), root) {
+        publish_snapshot();
+    }
 
 
+    /**
+     * Evaluates every live generative exactly once, following the schedule compiled on the latest change in
+     * topology. Since dependencies always are evaluated before their dependents, sockets read the stored output of
+     * the connected node rather than recursively pulling the graph.
+     *
+     * Only generatives reachable from a `Root` or from an observed generative (see `observe`) are live. Unreachable
+     * generatives, e.g. disconnected leftovers from editing, are never evaluated.
+     *
+     * The time of each cycle is published once to a TimeFrame shared by all generatives that support it (see
+     * `Generative::bind_time_frame`), which gate on its cycle id. Only other live generatives receive `update_time`.
+     *
+     * Never blocks on concurrent edits: changes to the graph are compiled into a new snapshot by the editing thread,
+     * which is picked up at the start of the next call. Connections of generatives in the graph (see
+     * `Generative::get_connection_slots`) are staged until then, and applied together with the snapshot, before any
+     * generative is evaluated. Parameter changes from other threads (see `enqueue_change`) are applied at the start of
+     * the call as well. Should not be called concurrently from multiple threads.
+     *
+     * Generatives that aren't time dependent (see `Generative::is_time_dependent`) are only evaluated if the output
+     * of any connected generative changed since their last evaluation. Since staged connections only change together
+     * with the snapshot, the dependencies compiled into it always are up to date, and the first cycle of every
+     * snapshot evaluates all generatives.
+     *
+     * Buffers allocated during the call (e.g. the outputs of generatives) are served from the graph's CycleArena, or
+     * from a CycleArena per worker thread when processing in parallel (see `set_num_threads`), meaning that
+     * steady-state processing doesn't use the global allocator for them.
+     */
     void process(const TimePoint& time) {
-        std::lock_guard<std::mutex> lock(m_process_mutex);
-        for (auto& generative: m_generatives) {
+        ThreadMemoryResource::Scope arena_scope{*m_arena};
+        m_arena->reclaim_remote();
+
+        const auto* snapshot = m_published.load(std::memory_order_acquire);
+
+        // removed and replaced generatives can't be reclaimed before the epoch of this snapshot is marked as in use
+        m_parameter_changes.apply_pending();
+
+        if (snapshot->epoch != m_last_epoch) {
+            for (const auto& [slot, target]: snapshot->connections) {
+                slot->apply(target);
+            }
+        }
+
+        for (const auto& handover: snapshot->handovers) {
+            if (!handover->done.exchange(true, std::memory_order_acq_rel))
+                handover->from->hand_over_to(*handover->to);
+        }
+
+        // From here on, any older snapshot (and any generative removed before this one) may be reclaimed
+        m_epoch_in_use.store(snapshot->epoch, std::memory_order_release);
+
+        // generatives following the frame (see `Generative::bind_time_frame`) don't need individual time updates
+        m_frame.advance(time);
+        for (auto* generative: snapshot->time_updated) {
             generative->update_time(time);
         }
 
-        for (auto* source: m_sources) {
-            source->process();
+        bool evaluate_all = snapshot->epoch != m_last_epoch
+                            || time.get_transport_running() != m_last_transport_running;
+        m_last_epoch = snapshot->epoch;
+        m_last_transport_running = time.get_transport_running();
+
+        if (snapshot->thread_pool) {
+            evaluate_parallel(*snapshot, evaluate_all);
+        } else {
+            for (std::size_t i = 0; i < snapshot->schedule.size(); ++i) {
+                evaluate(*snapshot, i, evaluate_all);
+            }
+        }
+
+        for (auto* generative: snapshot->schedule) {
+            generative->clear_output();
         }
     }
 
@@ -152,58 +360,271 @@ public:
     }
 
 
-    void add(std::unique_ptr<Generative> generative) {
-        std::lock_guard<std::mutex> lock(m_process_mutex);
+    /**
+     * Defers `change` to the start of the next cycle of `process`, where it's applied on the processing thread,
+     * e.g. `graph.enqueue_change([&sequence, v = std::move(values)] { sequence.set_values(v); })`.
+     * Lock-free, may be called concurrently from any number of threads. Changes are applied in order of enqueueing.
+     * A change throwing an exception is dropped (see `ParameterChangeQueue::apply_pending`).
+     *
+     * A change may safely reference any generative that is part of the graph when the change is enqueued,
+     * as removed generatives aren't destroyed until all changes enqueued before their removal have been applied.
+     *
+     * @return false if the queue is full (see `ParameterChangeQueue::DEFAULT_CAPACITY`), in which case the change
+     *         is discarded
+     */
+    bool enqueue_change(ParameterChangeQueue::Change change) {
+        return m_parameter_changes.push(std::move(change));
+    }
+
+
+    /**
+     * Adds `generative` to the order of evaluation maintained by the graph. Since the order is updated incrementally
+     * per connection, the cost of adding is proportional to the affected part of the graph rather than to its size.
+     * Publishing the edit to `process` is linear in the size of the graph, however, so adding many generatives one
+     * at a time should be done within `begin_edit` / `end_edit`.
+     *
+     * @return any cycles passing through the added generative. Generatives in cycles are still evaluated every
+     *         cycle, but in insertion order rather than in order of dependency
+     */
+    std::vector<std::vector<Generative*>> add(std::unique_ptr<Generative> generative) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        auto num_cyclic_edges = m_num_cyclic_edges;
+
+        auto* added = generative.get();
         add_internal(std::move(generative));
 
-        print_cycles();
+        commit_edit();
+        return cycles_through({added}, num_cyclic_edges);
     }
 
 
-    void add(std::vector<std::unique_ptr<Generative>> generatives) {
-        std::lock_guard<std::mutex> lock{m_process_mutex};
+    /**
+     * @return any cycles passing through at least one of the added generatives
+     */
+    std::vector<std::vector<Generative*>> add(std::vector<std::unique_ptr<Generative>> generatives) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        auto num_cyclic_edges = m_num_cyclic_edges;
+
+        std::vector<Generative*> added;
+        added.reserve(generatives.size());
+
         for (auto& generative: generatives) {
+            added.push_back(generative.get());
             add_internal(std::move(generative));
         }
-        print_cycles();
+
+        commit_edit();
+        return cycles_through(added, num_cyclic_edges);
     }
 
 
-    void remove(Generative& generative) {
-        std::lock_guard<std::mutex> lock(m_process_mutex);
+    /**
+     * Replaces `generative` with `replacement` without interrupting `process`:
+     * - every socket of `replacement` is connected to the same generative as the socket with the same id in
+     *   `generative`, if its type allows
+     * - every socket (or Outlet) connected to `generative` is reconnected to `replacement`, or disconnected if its
+     *   type doesn't allow
+     * - all of the above connections are staged (see `process`): a cycle in progress keeps reading `generative`
+     *   through the previous snapshot, and the next cycle switches every connection at once, before `generative`
+     *   hands over to `replacement` (see `Generative::hand_over_to`), e.g. releasing any held pulses through
+     *   `replacement`. From then on, only `replacement` is evaluated
+     * - `generative` itself is left untouched, and is destroyed once no snapshot referencing it can be in use
+     *
+     * @return any cycles passing through `replacement`
+     * @throw std::invalid_argument if `generative` isn't part of the graph
+     */
+    std::vector<std::vector<Generative*>> replace(Generative& generative, std::unique_ptr<Generative> replacement) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+
+        if (!contains(generative))
+            throw std::invalid_argument("Cannot replace a generative that isn't part of the graph");
+
+        auto num_cyclic_edges = m_num_cyclic_edges;
+        auto* added = replacement.get();
+        add_internal(std::move(replacement));
+
+        for (const auto& [socket_id, connected]: generative.get_connections()) {
+            if (connected != &generative)
+                added->try_connect(socket_id, *connected);
+        }
+
+        for (auto& other: m_generatives) {
+            if (other.get() == added || other.get() == &generative)
+                continue;
+
+            for (const auto& [socket_id, connected]: other->get_connections()) {
+                if (connected == &generative)
+                    other->try_connect(socket_id, *added);
+            }
+            other->disconnect_if(generative);
+        }
+
+        if (is_observed_internal(generative))
+            m_observed.insert(added);
+
         remove_internal(generative);
 
+        m_pending_handovers.emplace_back(std::make_shared<Handover>(&generative, added));
+        commit_edit();
+        return cycles_through({added}, num_cyclic_edges);
+    }
+
+
+    void remove(Generative& generative) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        remove_internal(generative);
+        commit_edit();
     }
 
 
     void remove(const std::vector<Generative*>& generatives) {
-        std::lock_guard<std::mutex> lock(m_process_mutex);
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
         remove_internal(generatives);
+        commit_edit();
     }
 
 
     void remove_generative_and_children(Generative& generative) {
-        std::lock_guard<std::mutex> lock{m_process_mutex};
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
 
         auto generative_and_children = find_generatives_matching(
                 generative.get_parameter_handler().get_id());
 
         disconnect_if(generative_and_children);
         remove_internal(generative_and_children);
+        commit_edit();
     }
 
 
-    Generative* find(const std::string& generative_id) {
-        auto it = std::find_if(m_generatives.begin()
-                               , m_generatives.end()
-                               , [&generative_id](const std::unique_ptr<Generative>& g) {
-                    return g->get_parameter_handler().get_id() == generative_id;
-                });
+    /**
+     * Connects the socket `socket_id` of `generative` to `source` (see `Generative::try_connect`) and publishes the
+     * edit, i.e. the connection takes effect from the next cycle on, scheduled after `source`.
+     *
+     * @return false if `generative` has no socket `socket_id` or if it doesn't accept the output type of `source`
+     * @throw std::invalid_argument if `generative` isn't part of the graph
+     */
+    bool connect(Generative& generative, const std::string& socket_id, Generative& source) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+
+        if (!contains(generative))
+            throw std::invalid_argument("Cannot connect a generative that isn't part of the graph");
+
+        if (!generative.try_connect(socket_id, source))
+            return false;
+
+        commit_edit();
+        return true;
+    }
+
+
+    /**
+     * Recompiles the schedule. Must be called whenever sockets of generatives in the graph are (re)connected
+     * directly rather than through the graph, as staged connections only take effect once a snapshot accounting for
+     * them has been published.
+     */
+    void update_schedule() {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        commit_edit();
+    }
+
+
+    /**
+     * Defers publishing edits to `process` until the matching `end_edit`, such that e.g. loading a patch one
+     * generative at a time compiles a single snapshot rather than one per generative. May be nested.
+     *
+     * Until then, `process` keeps running the latest published snapshot, which is also what `get_schedule` returns.
+     * Cycles closed by connecting generatives directly rather than through the graph are only detected once
+     * published, and are therefore not reported by `add` within the batch.
+     */
+    void begin_edit() {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        ++m_edit_depth;
+    }
+
+
+    /** Publishes all edits since the outermost `begin_edit`, if any */
+    void end_edit() {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        assert(m_edit_depth > 0);
+
+        if (--m_edit_depth == 0 && m_has_unpublished_edits)
+            publish_snapshot();
+    }
+
+
+    /**
+     * Keeps `generative` (and everything it depends on) live even if it isn't reachable from any `Root`,
+     * e.g. for generatives whose output is read outside the graph. It's no longer observed once removed.
+     *
+     * @throw std::invalid_argument if `generative` isn't part of the graph
+     */
+    void observe(Generative& generative) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+
+        if (!contains(generative))
+            throw std::invalid_argument("Cannot observe a generative that isn't part of the graph");
 
-        if (it != m_generatives.end())
-            return it->get();
-        else
-            return nullptr;
+        if (m_observed.insert(&generative).second)
+            commit_edit();
+    }
+
+
+    void unobserve(Generative& generative) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        if (m_observed.erase(&generative) > 0)
+            commit_edit();
+    }
+
+
+    bool is_observed(Generative& generative) const {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        return is_observed_internal(generative);
+    }
+
+
+    /**
+     * Evaluates independent generatives of each dependency level concurrently on `num_threads` threads
+     * (including the thread calling `process`). A value of 0 or 1 disables parallel processing.
+     */
+    void set_num_threads(std::size_t num_threads) {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        if (num_threads <= 1) {
+            m_thread_pool = nullptr;
+            m_worker_arenas = nullptr;
+        } else if (!m_thread_pool || m_thread_pool->num_threads() != num_threads) {
+            m_thread_pool = std::make_shared<ThreadPool>(num_threads);
+
+            auto arenas = std::make_shared<std::vector<CycleArena::Handle>>();
+            for (std::size_t i = 1; i < num_threads; ++i) {
+                arenas->emplace_back(CycleArena::create());
+            }
+            m_worker_arenas = std::move(arenas);
+        }
+        commit_edit();
+    }
+
+
+    std::size_t get_num_threads() const {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        return m_thread_pool ? m_thread_pool->num_threads() : 1;
+    }
+
+
+    /** @return all live generatives in order of evaluation, as of the latest published edit */
+    std::vector<Generative*> get_schedule() const {
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
+        return m_snapshots.back()->schedule;
+    }
+
+
+    /** @return all generatives in the graph, including those not reachable from any root or observed generative */
+    const std::vector<std::unique_ptr<Generative>>& get_generatives() const {
+        return m_generatives;
+    }
+
+
+    Generative* find(const std::string& generative_id) {
+        return m_identifiers.find(generative_id).value_or(nullptr);
     }
 
 
@@ -215,19 +636,12 @@ public:
         std::cout << "\n";
     }
 
+    /**
+     * @return all generatives with identifier `base_name` as well as any children on format <base_name>::.*,
+     *         in insertion order
+     */
     std::vector<Generative*> find_generatives_matching(const std::string& base_name) {
-        std::vector<Generative*> matching_generatives;
-
-        // match exact base name as well as any children on format <base_name>::.*
-        std::regex regex("^" + base_name + "(:{2}.*)?$");
-
-        for (const auto& generative: m_generatives) {
-            if (generative->get_parameter_handler().identifier_matches(regex)) {
-                matching_generatives.push_back(generative.get());
-            }
-        }
-
-        return matching_generatives;
+        return m_identifiers.find_matching(base_name);
     }
 
 
@@ -237,7 +651,7 @@ public:
 
 
     std::string next_id() {
-        std::lock_guard<std::mutex> lock{m_process_mutex};
+        std::lock_guard<std::mutex> lock{m_edit_mutex};
         std::string str = std::to_string(++m_last_id);
         str = std::string(N_DIGITS_ID - str.length(), '0') + str;
         return str;
@@ -245,7 +659,7 @@ public:
 
 
 //    std::string next_free_name(const std::string& suggested_name) {
-//        std::lock_guard<std::mutex> lock{m_process_mutex};
+//        std::lock_guard<std::mutex> lock{m_edit_mutex};
 //
 //
 //        if (std::find_if(m_generatives.begin()
@@ -274,26 +688,345 @@ public:
 
 
 private:
-    void print_cycles() const {
-        for (auto& cycle : GraphUtils::find_cycles(m_generatives)) {
-            // TODO: Temp: find better solution to indicate cycles
-            std::cout << "Cycle detected: ";
-            for (auto* node : cycle) {
-                std::cout << node->get_parameter_handler().get_id() << " ";
+    /** Replacement (see `replace`) to be handed over by `process`, exactly once, before the next cycle */
+    struct Handover {
+        Handover(Generative* from, Generative* to) : from(from), to(to) {}
+
+        Generative* from;
+        Generative* to;
+        std::atomic<bool> done{false};
+    };
+
+
+    /** Immutable state read by `process`, compiled from the graph on every edit */
+    struct Snapshot {
+        std::size_t epoch = 0;
+
+        std::vector<Generative*> schedule;
+
+        // generatives in `schedule` that don't follow the graph's TimeFrame
+        std::vector<Generative*> time_updated;
+
+        // end of each dependency level in `schedule`. Generatives after the last level are part of a cycle
+        std::vector<std::size_t> level_ends;
+
+        // connected generatives of each generative in `schedule`
+        std::vector<std::vector<Generative*>> dependencies;
+
+        // sum of the dependencies' output versions at the latest evaluation. Only accessed by `process`
+        mutable std::vector<std::size_t> input_versions;
+
+        std::shared_ptr<ThreadPool> thread_pool = nullptr;
+
+        // arena of each worker thread of `thread_pool`, i.e. each thread but the one calling `process`
+        std::shared_ptr<const std::vector<CycleArena::Handle>> worker_arenas = nullptr;
+
+        // handovers not yet performed by `process` as of this snapshot, in order of replacement
+        std::vector<std::shared_ptr<Handover>> handovers;
+
+        // target of every staged connection of every generative in the graph, applied when picked up by `process`
+        std::vector<std::pair<ConnectionSlot*, Generative*>> connections;
+    };
+
+
+    /** Publishes the current state of the graph to `process`, unless edits are batched (see `begin_edit`) */
+    void commit_edit() {
+        if (m_edit_depth > 0) {
+            m_has_unpublished_edits = true;
+        } else {
+            publish_snapshot();
+        }
+    }
+
+
+    /**
+     * Compiles the current state of the graph into a new snapshot and publishes it to `process`. Snapshots and
+     * removed generatives that no longer can be referenced by `process` are reclaimed.
+     */
+    void publish_snapshot() {
+        auto snapshot = std::make_unique<Snapshot>();
+        snapshot->epoch = m_snapshots.empty() ? 0 : m_snapshots.back()->epoch + 1;
+        snapshot->thread_pool = m_thread_pool;
+        snapshot->worker_arenas = m_worker_arenas;
+
+        // `process` may skip intermediate snapshots, hence all pending handovers are carried over until performed
+        if (!m_snapshots.empty()) {
+            for (const auto& handover: m_snapshots.back()->handovers) {
+                if (!handover->done.load(std::memory_order_acquire))
+                    snapshot->handovers.push_back(handover);
             }
-            std::cout << "\n";
         }
+        snapshot->handovers.insert(snapshot->handovers.end(), m_pending_handovers.begin(), m_pending_handovers.end());
+        m_pending_handovers.clear();
+
+        // connections made directly rather than through the graph are only known once synced
+        for (const auto& generative: m_generatives) {
+            sync_dependencies(*generative);
+        }
+
+        compile_schedule(*snapshot);
+
+        snapshot->dependencies.reserve(snapshot->schedule.size());
+        for (auto* generative: snapshot->schedule) {
+            snapshot->dependencies.emplace_back(m_dependencies.at(generative));
+
+            if (m_frame_followers.find(generative) == m_frame_followers.end())
+                snapshot->time_updated.push_back(generative);
+        }
+        snapshot->input_versions.resize(snapshot->schedule.size(), 0);
+
+        for (const auto& generative: m_generatives) {
+            for (auto* slot: generative->get_connection_slots()) {
+                snapshot->connections.emplace_back(slot, slot->target());
+            }
+        }
+
+        m_published.store(snapshot.get(), std::memory_order_release);
+        m_snapshots.emplace_back(std::move(snapshot));
+        m_has_unpublished_edits = false;
+
+        reclaim();
+    }
+
+
+    /**
+     * Orders all live generatives into dependency levels, following `m_order`. Linear in the number of live
+     * generatives and their connections, as the order itself is maintained incrementally (see `sync_dependencies`).
+     */
+    void compile_schedule(Snapshot& snapshot) const {
+        static constexpr std::size_t IN_CYCLE = std::numeric_limits<std::size_t>::max();
+
+        auto live = live_generatives();
+
+        // every generative in a cycle, or depending on one, is downstream of the target of some cyclic edge
+        std::unordered_set<const Generative*> cycle_entries;
+        for (const auto& [dependency, dependent]: m_order.cyclic_edges()) {
+            cycle_entries.insert(dependent);
+        }
+
+        // level of each live generative is one above the level of its deepest dependency, all of which precede it
+        std::unordered_map<const Generative*, std::size_t> level_of;
+        level_of.reserve(live.size());
+        std::vector<std::size_t> level_sizes;
+
+        m_order.for_each([&](Generative* generative) {
+            if (live.find(generative) == live.end())
+                return;
+
+            std::size_t level = cycle_entries.count(generative) > 0 ? IN_CYCLE : 0;
+            for (auto* dependency: m_dependencies.at(generative)) {
+                if (level == IN_CYCLE)
+                    break;
+
+                auto dependency_level = level_of.at(dependency);
+                level = dependency_level == IN_CYCLE ? IN_CYCLE : std::max(level, dependency_level + 1);
+            }
+
+            level_of.emplace(generative, level);
+            if (level != IN_CYCLE) {
+                level_sizes.resize(std::max(level_sizes.size(), level + 1), 0);
+                ++level_sizes[level];
+            }
+        });
+
+        std::vector<std::size_t> next_index;
+        next_index.reserve(level_sizes.size());
+        std::size_t num_ordered = 0;
+        for (auto size: level_sizes) {
+            next_index.push_back(num_ordered);
+            num_ordered += size;
+            snapshot.level_ends.push_back(num_ordered);
+        }
+
+        // within each level, and among generatives in cycles, generatives are evaluated in insertion order
+        snapshot.schedule.resize(level_of.size());
+        for (const auto& generative: m_generatives) {
+            auto it = level_of.find(generative.get());
+            if (it == level_of.end())
+                continue;
+
+            auto index = it->second == IN_CYCLE ? num_ordered++ : next_index[it->second]++;
+            snapshot.schedule[index] = generative.get();
+        }
+    }
+
+
+    /** @return all generatives reachable from a `Root` or from an observed generative through their dependencies */
+    std::unordered_set<const Generative*> live_generatives() const {
+        std::unordered_set<const Generative*> live;
+        std::vector<Generative*> stack;
+
+        auto visit = [&live, &stack](Generative* generative) {
+            if (live.insert(generative).second)
+                stack.push_back(generative);
+        };
+
+        for (auto* source: m_sources) {
+            visit(source);
+        }
+
+        for (auto* observed: m_observed) {
+            visit(observed);
+        }
+
+        while (!stack.empty()) {
+            auto* generative = stack.back();
+            stack.pop_back();
+
+            for (auto* dependency: m_dependencies.at(generative)) {
+                visit(dependency);
+            }
+        }
+
+        return live;
+    }
+
+
+    /**
+     * Updates the edges of `generative` in `m_order` to match its current connections, where only new connections
+     * may reorder the affected part of the graph. Connections to generatives outside the graph are ignored.
+     */
+    void sync_dependencies(Generative& generative) {
+        std::vector<Generative*> dependencies;
+        for (auto* connected: generative.get_connected()) {
+            if (connected && m_order.contains(connected))
+                dependencies.push_back(connected);
+        }
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+        auto& current = m_dependencies.at(&generative);
+        if (dependencies == current)
+            return;
+
+        for (auto* dependency: current) {
+            if (!std::binary_search(dependencies.begin(), dependencies.end(), dependency))
+                m_order.remove_edge(dependency, &generative);
+        }
+
+        for (auto* dependency: dependencies) {
+            if (!std::binary_search(current.begin(), current.end(), dependency)
+                && !m_order.add_edge(dependency, &generative)) {
+                ++m_num_cyclic_edges;
+            }
+        }
+
+        current = std::move(dependencies);
+    }
+
+
+    /** @return cycles through `generatives`, only searched for if a connection closed a cycle since `num_cyclic_edges` */
+    std::vector<std::vector<Generative*>> cycles_through(const std::vector<Generative*>& generatives
+                                                         , std::size_t num_cyclic_edges) const {
+        if (m_num_cyclic_edges == num_cyclic_edges)
+            return {};
+        return GraphUtils::find_cycles_through(generatives);
+    }
+
+
+    void reclaim() {
+        // `process` may be using the snapshot with epoch `in_use` or a newer one, but never an older one
+        auto in_use = m_epoch_in_use.load(std::memory_order_acquire);
+
+        m_snapshots.erase(std::remove_if(m_snapshots.begin(), m_snapshots.end() - 1, [in_use](const auto& snapshot) {
+            return snapshot->epoch < in_use;
+        }), m_snapshots.end() - 1);
+
+        // changes enqueued before the removal may still reference the generative until applied
+        auto num_applied = m_parameter_changes.num_applied();
+
+        auto reclaimed = std::partition(m_removed.begin(), m_removed.end(), [in_use, num_applied](const auto& removed) {
+            return removed.epoch > in_use || removed.num_changes > num_applied;
+        });
+
+        // only unbound once `process` no longer can evaluate them, as it advances the frame they gate on
+        for (auto it = reclaimed; it != m_removed.end(); ++it) {
+            if (it->follows_frame)
+                it->generative->bind_time_frame(nullptr);
+        }
+
+        m_removed.erase(reclaimed, m_removed.end());
+    }
+
+
+    static void evaluate(const Snapshot& snapshot, std::size_t index, bool force) {
+        auto* generative = snapshot.schedule[index];
+
+        if (!generative->is_time_dependent()) {
+            std::size_t input_version = 0;
+            for (auto* dependency: snapshot.dependencies[index]) {
+                input_version += dependency->get_output_version();
+            }
+
+            // output versions only increase, hence the sum only remains unchanged if no dependency changed
+            bool inputs_changed = input_version != snapshot.input_versions[index];
+            snapshot.input_versions[index] = input_version;
+
+            if (!force && !inputs_changed && generative->retain_output())
+                return;
+        }
+
+        generative->evaluate();
     }
 
-    void add_internal(std::unique_ptr<Generative> generative) {
-        if (std::find(m_generatives.begin(), m_generatives.end(), generative) != m_generatives.end())
-            throw std::runtime_error("Cannot add a generative twice");
 
-        if (auto* source = dynamic_cast<Root*>(generative.get())) {
+    static void evaluate_parallel(const Snapshot& snapshot, bool force) {
+        std::size_t level_begin = 0;
+        for (auto level_end: snapshot.level_ends) {
+            snapshot.thread_pool->parallel_for(level_end - level_begin, [&snapshot, level_begin, force](
+                    std::size_t i, std::size_t thread) {
+                if (thread == 0) {
+                    evaluate(snapshot, level_begin + i, force);
+                    return;
+                }
+
+                // the calling thread already has the graph's arena installed, workers install their own per task
+                auto& arena = *(*snapshot.worker_arenas)[thread - 1];
+                ThreadMemoryResource::Scope arena_scope{arena};
+                arena.reclaim_remote();
+                evaluate(snapshot, level_begin + i, force);
+            });
+            level_begin = level_end;
+        }
+
+        // generatives in cycles may recursively process each other and can therefore never run concurrently
+        for (std::size_t i = level_begin; i < snapshot.schedule.size(); ++i) {
+            evaluate(snapshot, i, force);
+        }
+    }
+
+
+    void add_internal(std::unique_ptr<Generative> generative) {
+        if (auto* source = generative->as_root()) {
             m_sources.emplace_back(source);
         }
 
+        if (generative->bind_time_frame(&m_frame))
+            m_frame_followers.insert(generative.get());
+
+        for (auto* slot: generative->get_connection_slots()) {
+            slot->set_staged(true);
+        }
+
+        m_identifiers.insert(generative->get_parameter_handler().get_id(), generative.get());
+
+        auto* added = generative.get();
         m_generatives.emplace_back(std::move(generative));
+
+        m_order.insert(added);
+        m_dependencies.emplace(added, std::vector<Generative*>{});
+        sync_dependencies(*added);
+    }
+
+
+    bool is_observed_internal(Generative& generative) const {
+        return m_observed.find(&generative) != m_observed.end();
+    }
+
+
+    bool contains(const Generative& generative) const {
+        // every generative in the graph has an entry in m_dependencies, even if it doesn't depend on anything
+        return m_dependencies.count(const_cast<Generative*>(&generative)) > 0;
     }
 
 
@@ -313,16 +1046,44 @@ private:
 
 
     void remove_internal(Generative& generative) {
-        if (auto* source = dynamic_cast<Root*>(&generative)) {
+        if (auto* source = generative.as_root()) {
             m_sources.erase(std::remove(m_sources.begin(), m_sources.end(), source), m_sources.end());
         }
 
-        m_generatives.erase(
-                std::remove_if(
-                        m_generatives.begin()
-                        , m_generatives.end()
-                        , [&generative](const auto& e) { return e.get() == &generative; }
-                ), m_generatives.end());
+        auto it = std::find_if(m_generatives.begin(), m_generatives.end(), [&generative](const auto& e) {
+            return e.get() == &generative;
+        });
+
+        if (it != m_generatives.end()) {
+            m_identifiers.remove(generative.get_parameter_handler().get_id(), &generative);
+            m_observed.erase(&generative);
+
+            bool follows_frame = m_frame_followers.erase(&generative) > 0;
+
+            // the address of the generative may be reused by a later addition, hence no dependent may still refer to it
+            for (auto* dependent: m_order.successors(&generative)) {
+                erase_dependency(*dependent, generative);
+            }
+            for (const auto& [dependency, dependent]: m_order.cyclic_edges()) {
+                if (dependency == &generative)
+                    erase_dependency(*dependent, generative);
+            }
+            m_order.erase(&generative);
+            m_dependencies.erase(&generative);
+
+            // `process` may still be evaluating the generative until the next snapshot has been picked up
+            m_removed.push_back({m_snapshots.back()->epoch + 1
+                                 , m_parameter_changes.num_pushed()
+                                 , follows_frame
+                                 , std::move(*it)});
+            m_generatives.erase(it);
+        }
+    }
+
+
+    void erase_dependency(Generative& dependent, const Generative& dependency) {
+        auto& dependencies = m_dependencies.at(&dependent);
+        dependencies.erase(std::remove(dependencies.begin(), dependencies.end(), &dependency), dependencies.end());
     }
 
 
@@ -337,10 +1098,65 @@ private:
 
     ParameterHandler m_parameter_handler;
 
-    std::mutex m_process_mutex;
+    mutable std::mutex m_edit_mutex;
 
     std::vector<std::unique_ptr<Generative>> m_generatives;
     std::vector<Root*> m_sources;
+    std::unordered_set<Generative*> m_observed;
+    IdentifierIndex<Generative*> m_identifiers;
+
+    // generatives following `m_frame` (see `Generative::bind_time_frame`)
+    std::unordered_set<Generative*> m_frame_followers;
+
+    // order of evaluation of all generatives, with an edge from each dependency to its dependents
+    TopologicalOrder<Generative*> m_order;
+
+    // dependencies of each generative in the graph as of the latest `sync_dependencies`, sorted and unique
+    std::unordered_map<Generative*, std::vector<Generative*>> m_dependencies;
+
+    // number of connections found to close a cycle by `sync_dependencies` so far
+    std::size_t m_num_cyclic_edges = 0;
+
+    // see `begin_edit`
+    std::size_t m_edit_depth = 0;
+    bool m_has_unpublished_edits = false;
+
+    std::shared_ptr<ThreadPool> m_thread_pool = nullptr;
+
+    // see `Snapshot::worker_arenas`
+    std::shared_ptr<const std::vector<CycleArena::Handle>> m_worker_arenas = nullptr;
+
+    // installed on the calling thread by `process`. Outlives the graph if any of its buffers still are in use
+    CycleArena::Handle m_arena = CycleArena::create();
+
+    // changes from any thread, applied by `process`
+    ParameterChangeQueue m_parameter_changes;
+
+    // handovers of `replace` not yet part of a published snapshot
+    std::vector<std::shared_ptr<Handover>> m_pending_handovers;
+
+    // All published snapshots not yet reclaimed, where the last one is the most recently published
+    std::vector<std::unique_ptr<Snapshot>> m_snapshots;
+
+    // Removed generatives along with the epoch of the first snapshot not containing them,
+    // the number of changes enqueued before their removal and whether they still follow `m_frame`
+    struct Removed {
+        std::size_t epoch;
+        std::size_t num_changes;
+        bool follows_frame;
+        std::unique_ptr<Generative> generative;
+    };
+    std::vector<Removed> m_removed;
+
+    std::atomic<const Snapshot*> m_published{nullptr};
+    std::atomic<std::size_t> m_epoch_in_use{0};
+
+    // Only accessed by `process`. Snapshots are identified by epoch, as the address of a reclaimed one may be reused
+    std::optional<std::size_t> m_last_epoch = std::nullopt;
+    bool m_last_transport_running = false;
+
+    // Only advanced by `process`, read by the generatives following it
+    TimeFrame m_frame;
 
     int m_last_id = 0;
 
@@ -6,6 +6,7 @@
 #include "core/temporal/transport.h"
 #include "core/collections/voices.h"
 #include "core/types/time_point.h"
+#include "core/utility/traits.h"
 #include "param/parameter_keys.h"
 
 
@@ -14,6 +15,26 @@
 
 namespace serialist {
 
+class ConnectionSlot;
+class Root;
+struct TimeFrame;
+
+namespace detail {
+/** Unique address per output type, used to identify `Node<T>` without RTTI */
+template<typename T>
+struct NodeTypeTag {
+    static constexpr char id = 0;
+};
+
+
+/** Unique address per output type, used to identify `MultiNode<T>` without RTTI */
+template<typename T>
+struct MultiNodeTypeTag {
+    static constexpr char id = 0;
+};
+} // namespace detail
+
+
 class Generative {
 public:
     static Specification specification(std::string id, std::string template_class) {
@@ -42,7 +63,87 @@ public:
     virtual void disconnect_if(Generative&) {}
 
 
+    /** @return id and connected generative of every connected socket, see `try_connect` */
+    virtual std::vector<std::pair<std::string, Generative*>> get_connections() { return {}; }
+
+
+    /** @return false if there's no socket `socket_id` or if it doesn't accept the output type of `generative` */
+    virtual bool try_connect(const std::string& /* socket_id */, Generative& /* generative */) { return false; }
+
+
+    /**
+     * @return every connection of the generative (see `ConnectionSlot`), which `GenerationGraph` stages so that
+     *         connection changes only take effect between two cycles. Generatives that don't expose their
+     *         connections switch connections immediately, and must therefore never be connected while processing
+     */
+    virtual std::vector<ConnectionSlot*> get_connection_slots() { return {}; }
+
+
+    /**
+     * Called on the processing thread, between two cycles, once this generative has been replaced by `replacement`
+     * in a running GenerationGraph (see `GenerationGraph::replace`). Hands over anything that must be released,
+     * e.g. pulse_offs for pulses still held by this generative
+     */
+    virtual void hand_over_to(Generative& /* replacement */) {}
+
+
     virtual void update_time(const TimePoint&) {}
+
+
+    /**
+     * Makes the generative follow `frame`, which is advanced once per cycle by its owner (e.g. `GenerationGraph`),
+     * rather than the time passed to `update_time`, or `update_time` again if `frame` is nullptr.
+     * @return false if not supported, in which case the owner must keep calling `update_time` every cycle
+     */
+    virtual bool bind_time_frame(const TimeFrame*) { return false; }
+
+
+    /**
+     * @return false if the output only depends on the outputs of the connected generatives (and on whether the
+     *         transport is running), in which case `GenerationGraph` may skip evaluation in cycles where none of
+     *         the connected generatives' outputs changed. Conservatively true unless overridden
+     */
+    virtual bool is_time_dependent() const { return true; }
+
+
+    /**
+     * Processes the generative once and stores the result in its output slot. Used by the compiled schedule of
+     * `GenerationGraph`, which evaluates every generative exactly once per cycle, after all of its dependencies
+     */
+    virtual void evaluate() = 0;
+
+
+    /** Invalidates the output slot written by `evaluate()`. Called by `GenerationGraph` at the end of each cycle */
+    virtual void clear_output() {}
+
+
+    /**
+     * Marks the output of the previous `evaluate()` as valid for the current cycle without processing the generative.
+     * @return false if there is no previous output to reuse, in which case the generative must be evaluated
+     */
+    virtual bool retain_output() { return false; }
+
+
+    /** @return this generative as a Root, or nullptr if it isn't one */
+    virtual Root* as_root() { return nullptr; }
+
+
+    /** @return tag identifying the output type of a `Node<T>` (see `node_cast`), or nullptr if it isn't a Node */
+    virtual const void* node_type() const { return nullptr; }
+
+
+    /** @return tag identifying the output type of a `MultiNode<T>` (see `multi_node_cast`), or nullptr otherwise */
+    virtual const void* multi_node_type() const { return nullptr; }
+
+
+    /** @return a counter incremented by `evaluate()` whenever the value in the output slot changes */
+    std::size_t get_output_version() const { return m_output_version; }
+
+protected:
+    void increment_output_version() { ++m_output_version; }
+
+private:
+    std::size_t m_output_version = 0;
 };
 
 
@@ -51,6 +152,10 @@ public:
 class Root : public Generative {
 public:
     virtual void process() = 0;
+
+    void evaluate() override { process(); }
+
+    Root* as_root() final { return this; }
 };
 
 
@@ -59,18 +164,219 @@ public:
 template<typename T>
 class Node : public Generative {
 public:
-    virtual Voices<T> process() = 0;
+    static const void* type_tag() { return &detail::NodeTypeTag<T>::id; }
+
+
+    /**
+     * @return the current value of the node. The reference remains valid until the next call to `process`, and is
+     *         typically the node's own state, meaning that it's only copied by consumers that need to keep it
+     */
+    virtual const Voices<T>& process() = 0;
+
+
+    const void* node_type() const final { return type_tag(); }
+
+
+    /** Stores the output of `process()`, which is only copied into a new buffer if it changed */
+    void evaluate() override {
+        const auto& output = process();
+
+        if (m_handed_over) {
+            auto merged = output;
+            merged.merge_uneven(*m_handed_over, true);
+            m_handed_over = std::nullopt;
+            store_if_changed(std::move(merged));
+        } else {
+            store_if_changed(output);
+        }
+
+        m_has_output = true;
+    }
+
+
+    void clear_output() override { m_has_output = false; }
+
+
+    bool retain_output() override {
+        m_has_output = static_cast<bool>(m_output);
+        return m_has_output;
+    }
+
+
+    /**
+     * Releases any held output, e.g. pulse_offs for all pulse_ons that have been output without a matching pulse_off.
+     * Not thread-safe: must not be called concurrently with `process`
+     */
+    virtual Voices<T> flush() { return Voices<T>::empty_like(); }
+
+
+    /** Output of `flush()` is merged into the next evaluation of `replacement`, if it's a node of the same type */
+    void hand_over_to(Generative& replacement) override {
+        if (replacement.node_type() != type_tag())
+            return;
+
+        auto flushed = flush();
+        if (flushed.is_empty_like())
+            return;
+
+        auto* node = static_cast<Node<T>*>(&replacement);
+
+        if (node->m_handed_over) {
+            node->m_handed_over->merge_uneven(flushed, true);
+        } else {
+            node->m_handed_over = std::move(flushed);
+        }
+    }
+
+
+    /** @return the value stored by `evaluate()` in the current cycle, or nullptr if not evaluated this cycle */
+    const Voices<T>* output() const { return m_has_output ? m_output.get() : nullptr; }
+
+
+    /**
+     * @return the value stored by `evaluate()` in the current cycle without copying it, or nullptr if not evaluated
+     *         this cycle. The buffer is never modified, and remains valid for as long as it's referenced
+     */
+    SharedVoices<T> shared_output() const { return m_has_output ? m_output : nullptr; }
+
+protected:
+    /**
+     * Alternative to `evaluate()` for nodes forwarding an output buffer shared with another generative.
+     * The output version is only incremented if `output` is a different buffer than the currently stored one
+     */
+    void store_output(SharedVoices<T> output) {
+        if (output != m_output) {
+            increment_output_version();
+            m_output = std::move(output);
+        }
+        m_has_output = true;
+    }
+
+private:
+    template<typename V>
+    void store_if_changed(V&& output) {
+        bool changed = true;
+        if constexpr (utils::is_equality_comparable_v<T>) {
+            changed = !m_output || *m_output != output;
+        }
+
+        // an unchanged output keeps its previous buffer, which consumers may still be referencing
+        if (changed) {
+            increment_output_version();
+            m_output = make_shared_voices(std::forward<V>(output));
+        }
+    }
+
+
+    SharedVoices<T> m_output = nullptr;
+    bool m_has_output = false;
+
+    std::optional<Voices<T>> m_handed_over = std::nullopt;
 };
 
 
+/**
+ * Equivalent of `dynamic_cast<Node<T>*>(generative)` for generatives deriving from a single Node,
+ * but a virtual call and a pointer comparison rather than an RTTI lookup
+ */
+template<typename T>
+Node<T>* node_cast(Generative* generative) {
+    if (generative && generative->node_type() == Node<T>::type_tag())
+        return static_cast<Node<T>*>(generative);
+    return nullptr;
+}
+
+
 // ==============================================================================================
 
 template<typename T>
 class MultiNode : public Generative {
 public:
-    virtual Vec<Voices<T>> process() = 0;
+    static const void* type_tag() { return &detail::MultiNodeTypeTag<T>::id; }
+
+
+    /** @return the current value of every outlet, see `Node::process` */
+    virtual const Vec<Voices<T>>& process() = 0;
+
+
+    const void* multi_node_type() const final { return type_tag(); }
+
+
+    /**
+     * @return the current value of a single outlet, or empty if `outlet` is out of bounds. Nodes that can produce
+     *         one outlet without copying all other outlets should override this
+     */
+    virtual Voices<T> process_outlet(std::size_t outlet) {
+        const auto& output = process();
+        if (outlet >= output.size())
+            return Voices<T>::empty_like();
+        return output[outlet];
+    }
+
+
+    /** Stores every outlet in a separate buffer. Only outlets whose value changed are copied into a new buffer */
+    void evaluate() override {
+        const auto& output = process();
+
+        bool changed = output.size() != m_outputs.size();
+        m_outputs.resize_default(output.size());
+
+        for (std::size_t i = 0; i < output.size(); ++i) {
+            if constexpr (utils::is_equality_comparable_v<T>) {
+                if (m_outputs[i] && *m_outputs[i] == output[i])
+                    continue;
+            }
+
+            m_outputs[i] = make_shared_voices(output[i]);
+            changed = true;
+        }
+
+        if (changed || !m_evaluated)
+            increment_output_version();
+
+        m_has_output = true;
+        m_evaluated = true;
+    }
+
+
+    void clear_output() override { m_has_output = false; }
+
+
+    bool retain_output() override {
+        m_has_output = m_evaluated;
+        return m_has_output;
+    }
+
+
+    /**
+     * @return the value of `outlet` stored by `evaluate()` in the current cycle, or nullptr if not evaluated this
+     *         cycle or if `outlet` is out of bounds
+     */
+    const Voices<T>* output(std::size_t outlet) const { return shared_output(outlet).get(); }
+
+
+    /** @return the value of `outlet` stored by `evaluate()` without copying it, see `Node::shared_output` */
+    SharedVoices<T> shared_output(std::size_t outlet) const {
+        if (!m_has_output || outlet >= m_outputs.size())
+            return nullptr;
+        return m_outputs[outlet];
+    }
+
+private:
+    Vec<SharedVoices<T>> m_outputs;
+    bool m_has_output = false;
+    bool m_evaluated = false;
 };
 
+
+/** Equivalent of `node_cast` for generatives deriving from a single MultiNode */
+template<typename T>
+MultiNode<T>* multi_node_cast(Generative* generative) {
+    if (generative && generative->multi_node_type() == MultiNode<T>::type_tag())
+        return static_cast<MultiNode<T>*>(generative);
+    return nullptr;
+}
+
 } // namespace serialist
 
 #endif //SERIALIST_LOOPER_GENERATIVE_H
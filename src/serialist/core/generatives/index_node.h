@@ -107,7 +107,7 @@ public:
             , m_reset_on_change(add_socket(Keys::RESET_ON_CHANGE, reset_on_change))
             , m_reset(add_socket(Keys::RESET, reset)) {}
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         auto t = pop_time();
         if (!t)
             return m_current_value;
@@ -118,8 +118,8 @@ public:
         }
 
 
-        auto trigger = m_trigger.process();
-        if (trigger.is_empty_like())
+        auto trigger = m_trigger.read();
+        if (trigger->is_empty_like())
             return m_current_value;
 
         auto num_voices = get_voice_count();
@@ -128,20 +128,19 @@ public:
             m_index_handlers.resize(num_voices);
         }
 
-        auto num_steps = m_num_steps.process().adapted_to(num_voices).firsts_or(IndexHandler::UNBOUNDED);
-        auto stride = m_stride.process().adapted_to(num_voices).firsts_or(IndexHandler::DEFAULT_STRIDE);
-        auto reset_triggers = m_reset.process().adapted_to(num_voices);
-        auto reset_on_change = m_reset_on_change.process().adapted_to(num_voices).firsts_or(IndexHandler::DEFAULT_RESET);
-        trigger.adapted_to(num_voices);
+        auto num_steps = m_num_steps.read()->adapted_firsts_or(num_voices, IndexHandler::UNBOUNDED);
+        auto stride = m_stride.read()->adapted_firsts_or(num_voices, IndexHandler::DEFAULT_STRIDE);
+        auto reset_triggers = m_reset.read();
+        auto reset_on_change = m_reset_on_change.read()->adapted_firsts_or(num_voices, IndexHandler::DEFAULT_RESET);
 
         m_current_value.adapted_to(num_voices);
 
         for (std::size_t i = 0; i < num_voices; ++i) {
-            if (Trigger::contains_pulse_on(reset_triggers[i])) {
+            if (Trigger::contains_pulse_on(reset_triggers->adapted_at(i))) {
                 m_index_handlers[i].reset();
             }
 
-            if (Trigger::contains_pulse_on(trigger[i])) {
+            if (Trigger::contains_pulse_on(trigger->adapted_at(i))) {
                 auto v = m_index_handlers[i].process(num_steps[i], stride[i], reset_on_change[i]);
                 m_current_value[i] = {static_cast<Facet>(v)};
             }
@@ -81,7 +81,7 @@ public:
         , m_uses_index(NodeBase<T>::add_socket(Keys::USES_INDEX, uses_index)) {}
 
 
-    Voices<T> process() override {
+    const Voices<T>& process() override {
         if (auto t = NodeBase<T>::pop_time(); !t) {
             return m_current_value;
         }
@@ -91,25 +91,24 @@ public:
             return m_current_value;
         }
 
-        auto trigger = m_trigger.process();
+        auto trigger = m_trigger.read();
 
-        if (trigger.is_empty_like()) {
+        if (trigger->is_empty_like()) {
             return m_current_value;
         }
 
-        auto cursor = m_cursor.process();
-        auto mode = m_mode.process();
-        auto octave = m_octave.process();
-        auto use_index = m_uses_index.process().first_or(Interpolator<T>::DEFAULT_USES_INDEX);
+        auto cursor = m_cursor.read();
+        auto mode = m_mode.read();
+        auto octave = m_octave.read();
+        auto use_index = m_uses_index.read()->first_or(Interpolator<T>::DEFAULT_USES_INDEX);
 
-        auto num_voices = NodeBase<T>::voice_count(trigger.size(), cursor.size(), mode.size(), octave.size());
+        auto num_voices = NodeBase<T>::voice_count(trigger->size(), cursor->size(), mode->size(), octave->size());
 
-        auto triggers = trigger.adapted_to(num_voices);
-        auto cursors = cursor.adapted_to(num_voices).firsts();
-        auto modes = mode.adapted_to(num_voices).firsts_or(Interpolator<T>::DEFAULT_MODE);
-        auto octaves = octave.adapted_to(num_voices).template firsts<T>();
+        auto cursors = cursor->adapted_firsts(num_voices);
+        auto modes = mode->adapted_firsts_or(num_voices, Interpolator<T>::DEFAULT_MODE);
+        auto octaves = octave->template adapted_firsts<T>(num_voices);
 
-        auto corpus = m_corpus.process();
+        auto corpus = m_corpus.read();
 
         m_current_value.adapted_to(num_voices);
 
@@ -119,16 +118,16 @@ public:
 
         m_previous_indices.resize_fold(num_voices);
 
-        for (std::size_t i = 0; i < trigger.size(); ++i) {
-            if (Trigger::contains_pulse_on(triggers[i]) && cursors[i].has_value()) {
+        for (std::size_t i = 0; i < num_voices; ++i) {
+            if (Trigger::contains_pulse_on(trigger->adapted_at(i)) && cursors[i].has_value()) {
                 if (use_index) {
                     auto index = Index::from_index_facet(*cursors[i]);
-                    m_current_value[i] = Interpolator<T>::process(index, corpus, modes[i], octaves[i]);
+                    m_current_value[i] = Interpolator<T>::process(index, *corpus, modes[i], octaves[i]);
                     m_previous_indices[i] = std::move(index);
 
                 } else {
-                    auto index = Index::from_phase_like(static_cast<double>(*cursors[i]), corpus.size());
-                    m_current_value[i] = Interpolator<T>::process(index, corpus, modes[i], octaves[i]);
+                    auto index = Index::from_phase_like(static_cast<double>(*cursors[i]), corpus->size());
+                    m_current_value[i] = Interpolator<T>::process(index, *corpus, modes[i], octaves[i]);
                     m_previous_indices[i] = std::move(index);
                 }
             }
@@ -6,6 +6,7 @@
 #include "core/types/trigger.h"
 #include "osc.h"
 #include "core/types/time_point.h"
+#include "core/temporal/time_gate.h"
 
 namespace serialist {
 
@@ -38,10 +39,8 @@ public:
               , m_trigger(add_socket(param::properties::trigger, trigger))
               , m_flatten(add_socket(FLATTEN, flatten))
               , m_trigger_on_change_only(add_socket(CHANGE, trigger_on_change_only))
-              , m_enabled(add_socket(param::properties::enabled, enabled)) {}
-
-
-    void update_time(const TimePoint& t) override { m_time_gate.push_time(t); }
+              , m_enabled(add_socket(param::properties::enabled, enabled))
+              , m_time_gate(time_source()) {}
 
 
     void process() override {
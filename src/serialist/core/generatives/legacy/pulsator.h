@@ -663,7 +663,7 @@ public:
               , m_legato_amount(add_socket(PulsatorKeys::LEGATO_AMOUNT, legato_amount))
               , m_sample_and_hold(add_socket(PulsatorKeys::SAMPLE_AND_HOLD, sample_and_hold)) {}
 
-    Voices<Trigger> process() override {
+    const Voices<Trigger>& process() override {
         auto t = pop_time();
         if (!t) // process has already been called this cycle
             return m_current_value;
@@ -44,7 +44,7 @@ public:
         , m_is_stepped(add_socket(Keys::IS_STEPPED, is_stepped))
         , m_reset(add_socket(Keys::RESET, reset)) {}
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         auto t = pop_time();
         if (!t)
             return m_current_value;
@@ -54,34 +54,33 @@ public:
             return m_current_value;
         }
 
-        auto trigger = m_trigger.process();
-        if (trigger.is_empty_like())
+        auto trigger = m_trigger.read();
+        if (trigger->is_empty_like())
             return m_current_value;
 
 
-        auto input = m_input.process();
-        auto tau = m_tau.process();
+        auto input = m_input.read();
+        auto tau = m_tau.read();
 
-        auto tau_type = m_tau_type.process().first_or(LowPass::DEFAULT_TAU_TYPE);
-        auto is_stepped = m_is_stepped.process().first_or(LowPass::DEFAULT_UNIT_STEP);
+        auto tau_type = m_tau_type.read()->first_or(LowPass::DEFAULT_TAU_TYPE);
+        auto is_stepped = m_is_stepped.read()->first_or(LowPass::DEFAULT_UNIT_STEP);
 
-        if (Trigger::contains_pulse_on(m_reset.process())) {
+        if (Trigger::contains_pulse_on(*m_reset.read())) {
             for (auto& filter : m_filters)
                 filter.reset();
         }
 
-        auto num_voices = voice_count(trigger.size(), input.size(), tau.size());
+        auto num_voices = voice_count(trigger->size(), input->size(), tau->size());
 
         if (num_voices != m_filters.size())
             m_filters.resize(num_voices);
 
-        auto triggers = trigger.adapted_to(num_voices);
-        auto inputs = input.adapted_to(num_voices).firsts();
-        auto taus = tau.adapted_to(num_voices).firsts_or(LowPass::DEFAULT_TAU);
+        auto inputs = input->adapted_firsts(num_voices);
+        auto taus = tau->adapted_firsts_or(num_voices, LowPass::DEFAULT_TAU);
 
         m_current_value.adapted_to(num_voices);
         for (size_t i = 0; i < num_voices; ++i) {
-            if (Trigger::contains_pulse_on(triggers[i])) {
+            if (Trigger::contains_pulse_on(trigger->adapted_at(i))) {
                 auto f = Facet{m_filters[i].process(*t, inputs[i], taus[i], tau_type, is_stepped)};
                 m_current_value[i] = Voice<Facet>::singular(f);
             }
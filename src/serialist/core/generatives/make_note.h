@@ -2,6 +2,7 @@
 #define SERIALISTLOOPER_MAKE_NOTE_H
 
 #include "core/types/event.h"
+#include "core/collections/flat_voices.h"
 #include "core/generative.h"
 #include "core/algo/pitch/notes.h"
 #include "core/types/trigger.h"
@@ -15,24 +16,38 @@
 namespace serialist {
 class MakeNote : Flushable<Event> {
 public:
+    using NoteView = FlatVoices<NoteNumber>::VoiceView;
+    using ValueView = FlatVoices<uint32_t>::VoiceView;
+
+
     Voice<Event> process(const Voice<Trigger>& triggers
                          , const Voice<NoteNumber>& chord
                          , const Voice<uint32_t>& velocities
                          , const Voice<uint32_t>& channel) {
+        return process(triggers, NoteView(chord), ValueView(velocities), ValueView(channel));
+    }
+
+
+    Voice<Event> process(const Voice<Trigger>& triggers, NoteView chord, ValueView velocities, ValueView channel) {
         Voice<Event> events;
 
         // Note: `triggers` may contain multiple triggers, but they do not correspond to individual notes in the chord
 
+        // Each event is positioned at the step offset of the trigger producing it, e.g. for BlockProcessor<Event>
+
         if (auto index = triggers.index([](const Trigger& trigger) {
             return trigger.is_pulse_off();
         })) {
-            events.extend(process_pulse_off(triggers[*index].get_id()));
+            const auto& trigger = triggers[*index];
+            events.extend(with_step_offset(process_pulse_off(trigger.get_id()), trigger.get_step_offset()));
         }
 
         if (auto index = triggers.index([](const Trigger& trigger) {
             return trigger.is_pulse_on();
         })) {
-            events.extend(process_pulse_on(triggers[*index].get_id(), chord, velocities, channel));
+            const auto& trigger = triggers[*index];
+            events.extend(with_step_offset(process_pulse_on(trigger.get_id(), chord, velocities, channel)
+                                           , trigger.get_step_offset()));
         }
 
         return events;
@@ -48,21 +63,22 @@ public:
 
 private:
     Voice<Event> process_pulse_on(const std::size_t trigger_id
-                                  , const Voice<NoteNumber>& notes
-                                  , const Voice<uint32_t>& velocities
-                                  , const Voice<uint32_t>& channels) {
+                                  , NoteView notes
+                                  , ValueView velocities
+                                  , ValueView channels) {
         if (notes.empty() || velocities.empty() || channels.empty()) {
             return {};
         }
 
-        // Individual velocities per note in a chord is possible, but velocities should not affect number of total notes
-        auto adapted_velocities = velocities.cloned().resize_fold(notes.size());
-
         auto events = Voice<Event>::allocated(notes.size() * channels.size());
         for (const auto& channel : channels) {
             for (std::size_t i = 0; i < notes.size(); ++i) {
+                // Individual velocities per note in a chord is possible, but velocities should not affect number of
+                // total notes (folded, i.e. equivalent to `velocities.resize_fold(notes.size())`)
+                auto velocity = velocities[i % velocities.size()];
+
                 m_held_notes.bind({trigger_id, notes[i], channel});
-                events.append(Event(MidiNoteEvent{notes[i], adapted_velocities[i], channel}));
+                events.append(Event(MidiNoteEvent{notes[i], velocity, channel}));
             }
         }
 
@@ -88,6 +104,14 @@ private:
     }
 
 
+    static Voice<Event> with_step_offset(Voice<Event>&& events, double step_offset) {
+        for (auto& event : events) {
+            event = event.with_step_offset(step_offset);
+        }
+        return std::move(events);
+    }
+
+
     /**
      * @brief Check if any other currently held pulse_on is associated with the same note
      */
@@ -134,7 +158,7 @@ public:
         , m_auto_channel(add_socket(Keys::AUTO_CHANNEL, auto_channel)){}
 
 
-    Voices<Event> process() override {
+    const Voices<Event>& process() override {
         auto t = pop_time();
         if (!t) {
             return m_current_value;
@@ -147,26 +171,30 @@ public:
             return m_current_value;
         }
 
+        // copied, as the trigger is adapted in place when broadcast
         auto trigger = m_trigger.process();
         if (trigger.is_empty_like()) {
             m_current_value = Voices<Event>::empty_like();
             return m_current_value;
         }
 
-        auto note_number = m_note_number.process();
-        auto velocity = m_velocity.process();
+        auto note_number = m_note_number.read();
+        auto velocity = m_velocity.read();
 
-        auto auto_channel = m_auto_channel.process().first_or(false);
+        auto auto_channel = m_auto_channel.read()->first_or(false);
 
         std::size_t num_voices;
-        auto channel = Voices<uint32_t>::empty_like();
+        auto channels = FlatVoices<uint32_t>::empty_like();
 
+        // inputs are adapted and converted into contiguous FlatVoices, one allocation each rather than one per voice
         if (auto_channel) {
-            num_voices = voice_count(trigger.size(), note_number.size(), velocity.size());
-            channel = Voices<uint32_t>::transposed(Voice<uint32_t>::range(1, num_voices + 1));
+            num_voices = voice_count(trigger.size(), note_number->size(), velocity->size());
+            channels = FlatVoices<uint32_t>(Vec<uint32_t>::range(1, static_cast<uint32_t>(num_voices) + 1)
+                                            , Vec<std::size_t>::range(0, num_voices + 1));
         } else {
-            channel = m_channel.process().as_type<uint32_t>();
-            num_voices = voice_count(trigger.size(), note_number.size(), velocity.size(), channel.size());
+            auto channel = m_channel.read();
+            num_voices = voice_count(trigger.size(), note_number->size(), velocity->size(), channel->size());
+            channels = FlatVoices<uint32_t>::adapted_from(*channel, num_voices);
         }
 
         auto output = Voices<Event>::zeros(num_voices);
@@ -177,9 +205,8 @@ public:
         }
 
         auto has_broadcast_changes = m_pulse_broadcast_handler.broadcast(trigger, num_voices);
-        auto note_numbers = note_number.adapted_to(num_voices).as_type<NoteNumber>();
-        auto velocities = velocity.adapted_to(num_voices).as_type<uint32_t>();
-        auto channels = channel.adapted_to(num_voices);
+        auto note_numbers = FlatVoices<NoteNumber>::adapted_from(*note_number, num_voices);
+        auto velocities = FlatVoices<uint32_t>::adapted_from(*velocity, num_voices);
 
         for (std::size_t i = 0; i < num_voices; ++i) {
             if (has_broadcast_changes[i]) {
@@ -194,13 +221,13 @@ public:
 
 
     /** (MaxMSP) Extra function for flushing outside the process chain (e.g. when Transport is stopped).
-     *           Note that this should never be used in a GenerationGraph, as the objects will be polled at least
-     *           once when the transport is stopped.
+     *           In a GenerationGraph, this is only used to hand over held pulses when the node is replaced
+     *           (see `Node::hand_over_to`), as the objects will be polled at least once when the transport is stopped.
      *           We need to implement a Socket<Trigger> flush for the GenerationGraph case
      *           (see PhasePulsatorNode for reference)
      *           This is not thread-safe.
      */
-    Voices<Event> flush() {
+    Voices<Event> flush() override {
         m_pulse_broadcast_handler.clear();
         return m_make_notes.flush();
     }
@@ -274,7 +274,9 @@ public:
               , m_lhs(add_socket(Keys::LHS, lhs))
               , m_rhs(add_socket(Keys::RHS, rhs)) {}
 
-    Voices<Facet> process() override {
+    bool is_time_dependent() const override { return false; }
+
+    const Voices<Facet>& process() override {
         if (!pop_time()) return m_current_value;
 
         if (!is_enabled() || !m_trigger.is_connected() || !m_type.is_connected() || !m_lhs.is_connected()) {
@@ -282,22 +284,24 @@ public:
             return m_current_value;
         }
 
-        if (m_trigger.process().is_empty_like())
+        if (m_trigger.read()->is_empty_like())
             return m_current_value;
 
-        auto type = m_type.process();
+        auto type = m_type.read();
+
+        // copied, as Operator::process modifies its operands
         auto lhs = m_lhs.process();
         auto rhs = m_rhs.process();
 
-        auto num_voices = voice_count(type.size(), lhs.size(), rhs.size());
+        auto num_voices = voice_count(type->size(), lhs.size(), rhs.size());
 
-        auto types = type.adapted_to(num_voices).firsts();
-        auto lhses = lhs.adapted_to(num_voices);
-        auto rhses = rhs.adapted_to(num_voices);
+        auto types = type->adapted_firsts(num_voices);
+        lhs.adapted_to(num_voices);
+        rhs.adapted_to(num_voices);
 
         auto output = Voices<Facet>::zeros(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
-            output[i] = Operator::process(lhses[i], rhses[i], utils::optional_cast<Operator::Type>(types[i]));
+            output[i] = Operator::process(lhs[i], rhs[i], utils::optional_cast<Operator::Type>(types[i]));
         }
 
         m_current_value = std::move(output);
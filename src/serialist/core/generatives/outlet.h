@@ -0,0 +1,124 @@
+
+#ifndef SERIALIST_OUTLET_H
+#define SERIALIST_OUTLET_H
+
+#include "core/connectable.h"
+#include "core/generative.h"
+#include "serialist/core/policies/policies.h"
+#include "core/param/parameter_keys.h"
+
+namespace serialist {
+
+/**
+ * @brief Exposes a single outlet of a MultiNode as a Node, so that it can be connected to any Socket.
+ *
+ * Within a GenerationGraph cycle, the outlet's buffer is shared with the MultiNode rather than copied, and the
+ * output version of the Outlet is only incremented when that particular outlet changes. Outside a cycle, only the
+ * requested outlet is copied (see `MultiNode::process_outlet`).
+ */
+template<typename T>
+class Outlet : public Node<T> {
+public:
+    inline static const std::string CLASS_NAME = "outlet";
+    inline static const std::string NODE = "node";
+
+    Outlet(const std::string& id, ParameterHandler& parent, MultiNode<T>* node, std::size_t outlet)
+            : m_parameter_handler(Generative::specification(id, CLASS_NAME), parent)
+            , m_node(node)
+            , m_outlet(outlet) {}
+
+
+    const Voices<T>& process() override {
+        auto* node = active_node();
+        if (!node) {
+            m_current_value = Voices<T>::empty_like();
+            return m_current_value;
+        }
+
+        // keeps the shared buffer alive for as long as the returned reference may be used
+        m_shared_value = node->shared_output(m_outlet);
+        if (m_shared_value)
+            return *m_shared_value;
+
+        m_current_value = node->process_outlet(m_outlet);
+        return m_current_value;
+    }
+
+
+    void evaluate() override {
+        auto* node = active_node();
+        if (auto output = node ? node->shared_output(m_outlet) : nullptr) {
+            Node<T>::store_output(std::move(output));
+        } else {
+            Node<T>::evaluate();
+        }
+    }
+
+
+    bool is_time_dependent() const override { return false; }
+
+
+    std::vector<Generative*> get_connected() override {
+        if (auto* node = m_node.target())
+            return {node};
+        return {};
+    }
+
+
+    std::vector<std::pair<std::string, Generative*>> get_connections() override {
+        if (auto* node = m_node.target())
+            return {{NODE, node}};
+        return {};
+    }
+
+
+    /** Connects to `generative` if `socket_id` is `NODE` and `generative` is a `MultiNode<T>` */
+    bool try_connect(const std::string& socket_id, Generative& generative) override {
+        if (socket_id != NODE)
+            return false;
+
+        if (auto* node = multi_node_cast<T>(&generative)) {
+            set_node(node);
+            return true;
+        }
+        return false;
+    }
+
+
+    std::vector<ConnectionSlot*> get_connection_slots() override { return {&m_node}; }
+
+
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+
+
+    void disconnect_if(Generative& connected_to) override {
+        if (m_node.target() == &connected_to) {
+            set_node(nullptr);
+        }
+    }
+
+
+    void set_node(MultiNode<T>* node) {
+        m_node.connect(node);
+    }
+
+
+    std::size_t get_outlet() const { return m_outlet; }
+
+private:
+    MultiNode<T>* active_node() const { return static_cast<MultiNode<T>*>(m_node.active()); }
+
+
+    ParameterHandler m_parameter_handler;
+
+    // only ever holds nodes of type `MultiNode<T>`
+    ConnectionSlot m_node;
+    const std::size_t m_outlet;
+
+    SharedVoices<T> m_shared_value = nullptr;
+    Voices<T> m_current_value = Voices<T>::empty_like();
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_OUTLET_H
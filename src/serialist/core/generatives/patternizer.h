@@ -163,7 +163,7 @@ public:
         , m_octave(NodeBase<T>::add_socket(Keys::OCTAVE, octave)) {}
 
 
-    Voices<T> process() override {
+    const Voices<T>& process() override {
         if (auto t = NodeBase<T>::pop_time(); !t) {
             return m_current_value;
         }
@@ -174,39 +174,35 @@ public:
             return m_current_value;
         }
 
-        auto trigger = m_trigger.process();
-        if (trigger.is_empty_like()) { return m_current_value; }
+        auto trigger = m_trigger.read();
+        if (trigger->is_empty_like()) { return m_current_value; }
 
-        auto chord = m_chord.process();
-        auto pattern = m_pattern.process();
-        auto mode = m_mode.process();
-        auto invert = m_inverse_selection.process();
-        auto pattern_uses_index = m_pattern_uses_index.process();
-        auto octave = m_octave.process();
+        auto chord = m_chord.read();
+        auto pattern = m_pattern.read();
+        auto mode = m_mode.read();
+        auto octave = m_octave.read();
 
-        auto num_voices = NodeBase<T>::voice_count(trigger.size(), chord.size(), pattern.size(), mode.size()
-                                                   , octave.size());
+        auto num_voices = NodeBase<T>::voice_count(trigger->size(), chord->size(), pattern->size(), mode->size()
+                                                   , octave->size());
 
         if (num_voices != m_patternizers.size())
             m_patternizers.resize(num_voices);
 
-        auto triggers = trigger.adapted_to(num_voices);
-        auto chords = chord.adapted_to(num_voices);
-        auto patterns = pattern.adapted_to(num_voices);
+        auto modes = mode->adapted_firsts_or(num_voices, Patternizer<T>::DEFAULT_MODE);
+        auto octaves = octave->adapted_firsts(num_voices);
 
-        auto modes = mode.adapted_to(num_voices).firsts_or(Patternizer<T>::DEFAULT_MODE);
-        auto octaves = octave.adapted_to(num_voices).firsts();
-
-        auto current_strategy = invert.first_or(Patternizer<T>::DEFAULT_INVERTED);
-        bool is_index = pattern_uses_index.first_or(Patternizer<T>::DEFAULT_PATTERN_USES_INDEX);
+        auto current_strategy = m_inverse_selection.read()->first_or(Patternizer<T>::DEFAULT_INVERTED);
+        bool is_index = m_pattern_uses_index.read()->first_or(Patternizer<T>::DEFAULT_PATTERN_USES_INDEX);
 
         m_current_value.adapted_to(num_voices);
         for (size_t i = 0; i < num_voices; ++i) {
-            if (Trigger::contains_pulse_on(triggers[i])) {
+            if (Trigger::contains_pulse_on(trigger->adapted_at(i))) {
                 if (is_index) {
                     m_current_value[i] = m_patternizers[i].process(
-                        chords[i]
-                        , patterns[i].template as_type<Index>([](const Facet& f) { return Index::from_index_facet(f); })
+                        chord->adapted_at(i)
+                        , pattern->adapted_at(i).template as_type<Index>([](const Facet& f) {
+                            return Index::from_index_facet(f);
+                        })
                         , modes[i]
                         , octaves[i]
                         , current_strategy
@@ -214,8 +210,8 @@ public:
 
                 } else {
                     m_current_value[i] = m_patternizers[i].process(
-                        chords[i]
-                        , patterns[i].template as_type<double>()
+                        chord->adapted_at(i)
+                        , pattern->adapted_at(i).template as_type<double>()
                         , modes[i]
                         , octaves[i]
                         , current_strategy
@@ -107,7 +107,7 @@ public:
         , m_durations(add_socket(Keys::DURATIONS, durations)) {}
 
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         if (!pop_time())
             return m_current_value;
 
@@ -117,7 +117,7 @@ public:
             return m_current_value;
         }
 
-        if (m_trigger.process().is_empty_like())
+        if (m_trigger.read()->is_empty_like())
             return m_current_value;
 
         auto num_voices = get_voice_count();
@@ -129,15 +129,14 @@ public:
 
         update_parameters(num_voices, resized);
 
-        auto cursor_input = m_cursor.process();
-        if (cursor_input.is_empty_like()) {
+        auto cursor_input = m_cursor.read();
+        if (cursor_input->is_empty_like()) {
             m_current_value = Voices<Facet>::empty_like();
             return m_current_value;
         }
 
 
-        auto cursors = cursor_input.adapted_to(num_voices)
-                .firsts_or(0.0)
+        auto cursors = cursor_input->adapted_firsts_or(num_voices, 0.0)
                 .as_type<Phase>([](auto phase) { return Phase(phase); });
 
         auto output = Voices<Facet>::zeros(num_voices);
@@ -159,7 +158,8 @@ private:
 
     void update_parameters(std::size_t num_voices, bool size_has_changed) {
         if (size_has_changed || m_durations.has_changed()) {
-            auto durations = m_durations.process().adapted_to(num_voices).as_type<double>();
+            auto durations = m_durations.read()->as_type<double>();
+            durations.adapted_to(num_voices);
             m_phase_maps.set(&PhaseMap::set_durations, std::move(durations));
         }
     }
@@ -52,7 +52,7 @@ public:
               , m_step_size(add_socket(Keys::STEP_SIZE, step_size))
               , m_reset(add_socket(Keys::RESET, reset)) {}
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         auto t = pop_time();
         if (!t)
             return m_current_value;
@@ -62,13 +62,12 @@ public:
             return m_current_value;
         }
 
-        auto reset_triggers = m_reset.process();
-        if (Trigger::contains_pulse_on(reset_triggers)) {
+        if (Trigger::contains_pulse_on(*m_reset.read())) {
             reset();
         }
 
-        auto trigger = m_trigger.process();
-        if (trigger.is_empty_like())
+        auto trigger = m_trigger.read();
+        if (trigger->is_empty_like())
             return m_current_value;
 
         auto num_voices = get_voice_count();
@@ -80,11 +79,9 @@ public:
 
         update_parameters(num_voices, resized);
 
-        trigger.adapted_to(num_voices);
-
         auto output = Voices<Facet>::zeros(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
-            bool has_trigger = Trigger::contains_pulse_on(trigger[i]);
+            bool has_trigger = Trigger::contains_pulse_on(trigger->adapted_at(i));
             output[i].append(static_cast<Facet>(m_phases[i].process(*t, has_trigger)));
         }
 
@@ -102,13 +99,11 @@ private:
 
     void update_parameters(std::size_t num_voices, bool resized) {
         m_phases.set(&PhaseAccumulator::set_mode
-                          , adapted(m_mode.process(), num_voices, PhaseAccumulator::DEFAULT_MODE));
+                          , adapted(*m_mode.read(), num_voices, PhaseAccumulator::DEFAULT_MODE));
 
-        // TODO: This has_changed is completely redundant: we've already called process() in get_voice_count,
-        //       so has_changed is always false here
         if (resized || m_period.has_changed() || m_period_type.has_changed()) {
-            auto period = m_period.process().adapted_to(num_voices).firsts_or(PaParameters::DEFAULT_PERIOD);
-            auto period_type = m_period_type.process().first_or(PaParameters::DEFAULT_PERIOD_TYPE);
+            auto period = m_period.read()->adapted_firsts_or(num_voices, PaParameters::DEFAULT_PERIOD);
+            auto period_type = m_period_type.read()->first_or(PaParameters::DEFAULT_PERIOD_TYPE);
 
             for (std::size_t i = 0; i < num_voices; ++i) {
                 m_phases[i].set_period(DomainDuration{period[i], period_type});
@@ -116,8 +111,8 @@ private:
         }
 
         if (resized || m_offset.has_changed() || m_offset_type.has_changed()) {
-            auto offset = m_offset.process().adapted_to(num_voices).firsts_or(PaParameters::DEFAULT_OFFSET);
-            auto offset_type = m_offset_type.process().first_or(PaParameters::DEFAULT_OFFSET_TYPE);
+            auto offset = m_offset.read()->adapted_firsts_or(num_voices, PaParameters::DEFAULT_OFFSET);
+            auto offset_type = m_offset_type.read()->first_or(PaParameters::DEFAULT_OFFSET_TYPE);
 
             for (std::size_t i = 0; i < num_voices; ++i) {
                 m_phases[i].set_offset(DomainDuration{offset[i], offset_type});
@@ -125,7 +120,7 @@ private:
         }
 
         m_phases.set(&PhaseAccumulator::set_step_size
-                     , adapted(m_step_size.process(), num_voices, PaParameters::DEFAULT_STEP_SIZE));
+                     , adapted(*m_step_size.read(), num_voices, PaParameters::DEFAULT_STEP_SIZE));
     }
 
     void reset() {
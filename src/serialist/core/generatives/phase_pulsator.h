@@ -173,6 +173,7 @@ public:
     Trigger trigger() const { return Trigger::pulse_off(m_trigger_id); }
     std::size_t trigger_id() const { return m_trigger_id; }
     double legato_value() const { return m_legato_value; }
+    const Phase& threshold_position() const { return m_threshold_position; }
 
 private:
     bool has_remaining_passes() const { return m_num_remaining_passes > 0; }
@@ -384,7 +385,11 @@ private:
     static Voice<Trigger> handle_threshold_crossing(const Phase& cursor, State& s, const Params& p) {
         if (auto crossing_direction = direction(cursor);
             !s.expected_direction || crossing_direction == *s.expected_direction) {
-            return trigger_pulse(cursor, s, p);
+            auto step_offset = Phase::crossing_fraction(*s.previous_cursor
+                                                        , cursor
+                                                        , Phase::zero()
+                                                        , to_phase_direction(crossing_direction));
+            return trigger_pulse(cursor, s, p, step_offset);
         } else {
             flip_legato_thresholds(crossing_direction, s);
             s.expected_direction = crossing_direction;
@@ -401,6 +406,7 @@ private:
             return {};
 
         Voice<Trigger> triggers;
+        double step_offset = 1.0;
 
         auto process_threshold = [&](std::optional<LegatoThreshold>& threshold) {
             if (!threshold) return;
@@ -409,7 +415,11 @@ private:
                                                  , cursor
                                                  , *s.expected_direction
                                                  , explicit_crossing_direction)) {
-                triggers.append(threshold->trigger());
+                // an explicit direction implies a jump, which occurs at the current time point
+                step_offset = explicit_crossing_direction
+                              ? 1.0
+                              : Phase::crossing_fraction(*s.previous_cursor, cursor, threshold->threshold_position());
+                triggers.append(threshold->trigger().with_step_offset(step_offset));
                 threshold = std::nullopt;
             }
         };
@@ -420,7 +430,7 @@ private:
         // Ensure previous threshold is not extended past current
         if (!s.current_legato_threshold && s.previous_legato_threshold) {
             // insert at front to ensure that the outgoing triggers are sorted
-            triggers.insert(0, s.previous_legato_threshold->trigger());
+            triggers.insert(0, s.previous_legato_threshold->trigger().with_step_offset(step_offset));
             s.previous_legato_threshold = std::nullopt;
         }
 
@@ -428,21 +438,22 @@ private:
     }
 
 
-    static Voice<Trigger> trigger_pulse(const Phase& cursor, State& s, const Params& p) {
+    /** @param step_offset position of the threshold crossing within the time step, see `Trigger::with_step_offset` */
+    static Voice<Trigger> trigger_pulse(const Phase& cursor, State& s, const Params& p, double step_offset = 1.0) {
         Voice<Trigger> triggers;
 
         auto crossing_direction = direction(cursor);
 
         // Release previous threshold (We're never supposed to hold more than two pulses at a time)
         if (s.previous_legato_threshold) {
-            triggers.append(s.previous_legato_threshold->trigger());
+            triggers.append(s.previous_legato_threshold->trigger().with_step_offset(step_offset));
             s.previous_legato_threshold = std::nullopt;
         }
 
         // Release current threshold or move it to previous
         if (s.current_legato_threshold) {
             if (s.current_legato_threshold->legato_value() <= 1.0 || p.legato == 0.0) {
-                triggers.append(s.current_legato_threshold->trigger());
+                triggers.append(s.current_legato_threshold->trigger().with_step_offset(step_offset));
             } else {
                 s.previous_legato_threshold = s.current_legato_threshold;
 
@@ -457,7 +468,7 @@ private:
         }
 
         // Generate new pulse
-        auto pulse_on = Trigger::pulse_on();
+        auto pulse_on = Trigger::pulse_on().with_step_offset(step_offset);
         triggers.append(pulse_on);
         s.expected_direction = crossing_direction;
 
@@ -472,7 +483,7 @@ private:
                 , static_cast<std::size_t>(p.legato > 1.0)
             };
         } else {
-            triggers.append(Trigger::pulse_off(pulse_on.get_id()));
+            triggers.append(Trigger::pulse_off(pulse_on.get_id()).with_step_offset(step_offset));
         }
 
         return triggers;
@@ -670,10 +681,11 @@ public:
 
 
     /** (MaxMSP) Extra function for flushing outside the process chain (e.g. when Transport is stopped).
-     *           Note that this should never be used in a GenerationGraph, as the objects will be polled at least
-     *           once when the transport is stopped. This is not thread-safe.
+     *           In a GenerationGraph, this is only used to hand over held pulses when the node is replaced
+     *           (see `Node::hand_over_to`), as the objects will be polled at least once when the transport is stopped.
+     *           This is not thread-safe.
      */
-    Voices<Trigger> flush() {
+    Voices<Trigger> flush() override {
         return pulsators().flush();
     }
 
@@ -697,16 +709,14 @@ private:
 
     void update_parameters(std::size_t num_voices, bool size_has_changed) override {
         if (size_has_changed || m_legato.has_changed()) {
-            auto legato = m_legato.process()
-                    .adapted_to(num_voices)
-                    .firsts_or(PhasePulsatorParameters::DEFAULT_LEGATO);
+            auto legato = m_legato.read()->adapted_firsts_or(num_voices, PhasePulsatorParameters::DEFAULT_LEGATO);
             pulsators().set(&PhasePulsator::set_legato, std::move(legato));
         }
 
         if (size_has_changed || m_durations.has_changed()) {
             // Note: We do not handle polyphonic sequences. If we need multiple sequences synchronized to a single
             //       oscillator, the optimal approach is to use multiple PhasePulsator objects instead.
-            auto durations = m_durations.process().firsts_or(0.0);
+            auto durations = m_durations.read()->firsts_or(0.0);
             pulsators().set(&PhasePulsator::set_durations, durations);
         }
 
@@ -736,9 +746,8 @@ private:
             return triggers;
         }
 
-        auto cursors = m_cursor.process()
-                .adapted_to(num_voices)
-                .firsts_or(0.0)
+        auto cursors = m_cursor.read()
+                ->adapted_firsts_or(num_voices, 0.0)
                 .as_type<Phase>([](auto phase) { return Phase(phase); });
 
         auto& p = pulsators();
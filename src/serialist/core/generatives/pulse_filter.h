@@ -33,11 +33,23 @@ class PulseFilter : public Flushable<Trigger> {
         virtual Voice<Trigger> activate(PulseState& pulses) { return {}; };
         virtual Voice<Trigger> deactivate(PulseState& pulses) { return {}; };
 
-        static Voice<Trigger> flush(PulseState& pulses) {
-            return ids_to_pulse_offs(pulses.flush());
+        static Voice<Trigger> flush(PulseState& pulses, double step_offset = 1.0) {
+            return ids_to_pulse_offs(pulses.flush(), step_offset);
         }
 
     protected:
+        /** Position within the time step of the earliest pulse_off in `triggers`, see `Trigger::with_step_offset` */
+        static double pulse_off_step_offset(const Voice<Trigger>& triggers) {
+            double step_offset = 1.0;
+            for (const auto& trigger : triggers) {
+                if (trigger.is_pulse_off()) {
+                    step_offset = std::min(step_offset, trigger.get_step_offset());
+                }
+            }
+            return step_offset;
+        }
+
+
         static void register_pulse_ons(const Voice<Trigger>& triggers, PulseState& pulses) {
             for (const auto& trigger : triggers) {
                 if (trigger.is_pulse_on()) {
@@ -80,14 +92,14 @@ class PulseFilter : public Flushable<Trigger> {
         }
 
 
-        static Voice<Trigger> flush_triggered(PulseState& pulses) {
-            return ids_to_pulse_offs(pulses.flush([](const PulseIdentifier& p) { return !p.triggered; }));
+        static Voice<Trigger> flush_triggered(PulseState& pulses, double step_offset = 1.0) {
+            return ids_to_pulse_offs(pulses.flush([](const PulseIdentifier& p) { return !p.triggered; }), step_offset);
         }
 
 
-        static Voice<Trigger> ids_to_pulse_offs(const Voice<PulseIdentifier>& ids) {
-            return ids.as_type<Trigger>([](const PulseIdentifier& p) {
-                return Trigger::pulse_off(p.id);
+        static Voice<Trigger> ids_to_pulse_offs(const Voice<PulseIdentifier>& ids, double step_offset = 1.0) {
+            return ids.as_type<Trigger>([step_offset](const PulseIdentifier& p) {
+                return Trigger::pulse_off(p.id).with_step_offset(step_offset);
             });
         }
 
@@ -105,7 +117,7 @@ class PulseFilter : public Flushable<Trigger> {
 
             // We may have lingering pulses from a previous non-immediate closed state
             if (Trigger::contains_pulse_off(triggers)) {
-                flushed = flush_triggered(pulses);
+                flushed = flush_triggered(pulses, pulse_off_step_offset(triggers));
             }
 
             register_pulse_ons(triggers, pulses);
@@ -138,7 +150,7 @@ class PulseFilter : public Flushable<Trigger> {
     public:
         Voice<Trigger> process(Voice<Trigger>&& triggers, PulseState& pulses) override {
             if (Trigger::contains_pulse_off(triggers)) {
-                return flush(pulses);
+                return flush(pulses, pulse_off_step_offset(triggers));
             }
 
             return {};
@@ -301,7 +313,7 @@ public:
 
     // TODO: Lots of unnecessary code duplication from MakeNote (and PhasePulsator) => generalize base class
 
-    Voices<Trigger> process() override {
+    const Voices<Trigger>& process() override {
         auto t = pop_time();
         if (!t) {
             return m_current_value;
@@ -314,11 +326,12 @@ public:
             return m_current_value;
         }
 
+        // copied, as the triggers are handed over to each PulseFilter
         auto trigger = m_trigger.process();
-        auto filter_state = m_filter_state.process();
-        auto immediate = m_immediate.process().first_or(PulseFilter::DEFAULT_IMMEDIATE_VALUE);
+        auto filter_state = m_filter_state.read();
+        auto immediate = m_immediate.read()->first_or(PulseFilter::DEFAULT_IMMEDIATE_VALUE);
 
-        auto num_voices = voice_count(trigger.size(), filter_state.size());
+        auto num_voices = voice_count(trigger.size(), filter_state->size());
 
         auto output = Voices<Trigger>::zeros(num_voices);
 
@@ -327,11 +340,11 @@ public:
             output.merge_uneven(m_pulse_filters.resize(num_voices), true);
         }
 
-        auto triggers = trigger.adapted_to(num_voices);
-        auto filter_states = filter_state.adapted_to(num_voices).firsts_or(PulseFilter::DEFAULT_STATE);
+        trigger.adapted_to(num_voices);
+        auto filter_states = filter_state->adapted_firsts_or(num_voices, PulseFilter::DEFAULT_STATE);
 
         for (std::size_t i = 0; i < num_voices; ++i) {
-            output[i].extend(m_pulse_filters[i].process(std::move(triggers[i]), filter_states[i], immediate));
+            output[i].extend(m_pulse_filters[i].process(std::move(trigger[i]), filter_states[i], immediate));
         }
 
         m_current_value = std::move(output);
@@ -340,13 +353,13 @@ public:
 
 
     /** (MaxMSP) Extra function for flushing outside the process chain (e.g. when Transport is stopped).
-     *           Note that this should never be used in a GenerationGraph, as the objects will be polled at least
-     *           once when the transport is stopped.
+     *           In a GenerationGraph, this is only used to hand over held pulses when the node is replaced
+     *           (see `Node::hand_over_to`), as the objects will be polled at least once when the transport is stopped.
      *           We need to implement a Socket<Trigger> flush for the GenerationGraph case
      *           (see PhasePulsatorNode for reference)
      *           This is not thread-safe.
      */
-    Voices<Trigger> flush() {
+    Voices<Trigger> flush() override {
         return m_pulse_filters.flush();
     }
 
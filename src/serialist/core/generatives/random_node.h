@@ -456,7 +456,7 @@ public:
         , m_weights(add_socket(Keys::WEIGHTS, weights)) {}
 
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         if (auto t = pop_time(); !t)
             return m_current_value;
 
@@ -465,8 +465,8 @@ public:
             return m_current_value;
         }
 
-        auto trigger = m_trigger.process();
-        if (trigger.is_empty_like())
+        auto trigger = m_trigger.read();
+        if (trigger->is_empty_like())
             return m_current_value;
 
         auto num_voices = get_voice_count();
@@ -478,13 +478,11 @@ public:
 
         update_parameters(num_voices, resized);
 
-        auto chord_sizes = m_chord_size.process(num_voices).firsts_or(RandomHandler::DEFAULT_CHORD_SIZE);
-
-        trigger.adapted_to(num_voices);
+        auto chord_sizes = m_chord_size.read()->adapted_firsts_or(num_voices, RandomHandler::DEFAULT_CHORD_SIZE);
 
         m_current_value.adapted_to(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
-            if (Trigger::contains_pulse_on(trigger[i])) {
+            if (Trigger::contains_pulse_on(trigger->adapted_at(i))) {
                 m_current_value[i] = m_random_handlers[i].process(chord_sizes[i]).as_type<Facet>();
             }
         }
@@ -508,12 +506,12 @@ private:
 
 
     void update_parameters(std::size_t num_voices, bool resized) {
-        auto mode = m_mode.process().first_or(RandomHandler::DEFAULT_MODE);
-        auto reps = m_repetition_strategy.process().first_or(RandomHandler::DEFAULT_REPETITIONS);
-        auto steps = m_num_quantization_steps.process(num_voices).firsts_or(RandomHandler::DEFAULT_QUANTIZATION);
-        auto brownian_step = m_max_brownian_step.process().first_or(RandomHandler::DEFAULT_BROWNIAN_STEP);
-        auto exp_lb = m_exp_lower_bound.process().first_or(RandomHandler::DEFAULT_EXP_LOWER_BOUND);
-        auto weights = m_weights.process().firsts_or<double>(0.0);
+        auto mode = m_mode.read()->first_or(RandomHandler::DEFAULT_MODE);
+        auto reps = m_repetition_strategy.read()->first_or(RandomHandler::DEFAULT_REPETITIONS);
+        auto steps = m_num_quantization_steps.read()->adapted_firsts_or(num_voices, RandomHandler::DEFAULT_QUANTIZATION);
+        auto brownian_step = m_max_brownian_step.read()->first_or(RandomHandler::DEFAULT_BROWNIAN_STEP);
+        auto exp_lb = m_exp_lower_bound.read()->first_or(RandomHandler::DEFAULT_EXP_LOWER_BOUND);
+        auto weights = m_weights.read()->firsts_or<double>(0.0);
 
         m_random_handlers.set(&RandomHandler::set_mode, mode);
         m_random_handlers.set(&RandomHandler::set_repetition_strategy, reps);
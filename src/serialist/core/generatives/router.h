@@ -231,7 +231,7 @@ public:
      * @brief apply to 1-1 mapping (i.e. mapping defines individual voices in 1 inlet 1 outlet)
      */
     template<typename T>
-    Voices<T> apply_single(Voices<T>&& input) const {
+    Voices<T> apply_single(const Voices<T>& input) const {
         if (m_mapping.empty()) {
             return Voices<T>::empty_like();
         }
@@ -252,7 +252,7 @@ public:
      * @brief apply to N-M mapping (i.e. mapping defines inlet and outlets)
      */
     template<typename T>
-    MultiVoices<T> apply_multi(MultiVoices<T>&& input) const {
+    MultiVoices<T> apply_multi(const MultiVoices<T>& input) const {
         if (m_mapping.empty()) {
             return {Voices<T>::empty_like()};
         }
@@ -340,7 +340,7 @@ public:
 
 
     template<typename T>
-    MultiVoices<T> apply(MultiVoices<T>&& input) {
+    MultiVoices<T> apply(const MultiVoices<T>& input) {
         assert(input.size() >= m_mapping.size());
 
         auto merged = Vec<Voice<T>>::allocated(m_mapping.sum());
@@ -451,7 +451,7 @@ public:
 
 
     template<typename T>
-    MultiVoices<T> apply(Voices<T>&& input) {
+    MultiVoices<T> apply(const Voices<T>& input) {
         auto split = MultiVoices<T>::repeated(m_mapping.size(), Voices<T>::empty_like());
 
         std::size_t start = 0;
@@ -542,7 +542,7 @@ public:
 
 
     template<typename T>
-    MultiVoices<T> apply(MultiVoices<T>&& input) {
+    MultiVoices<T> apply(const MultiVoices<T>& input) {
         if (m_mapping.empty()) {
             return {Voices<T>::empty_like()};
         }
@@ -643,7 +643,7 @@ public:
 
 
     template<typename T>
-    MultiVoices<T> apply(Voices<T>&& input) {
+    MultiVoices<T> apply(const Voices<T>& input) {
         auto distributed = Vec<Vec<Voice<T>>>::repeated(m_mapping.size(), Vec<Voice<T>>{});
 
         for (std::size_t inlet_index = 0; inlet_index < m_mapping.size(); ++inlet_index) {
@@ -950,7 +950,7 @@ public:
     }
 
 
-    std::pair<MultiVoices<T>, RouterMapping> process(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> process(const MultiVoices<T>& input
                                                      , const Voices<Facet>& mapping
                                                      , RouterMode mode
                                                      , Index::Type index_type) {
@@ -963,20 +963,20 @@ public:
         // Single only supports modes route and through, hence the separate implementation
         if (m_num_inlets == 1 && m_num_outlets == 1) {
             if (mode == RouterMode::through) {
-                return through_single(std::move(input), mapping);
+                return through_single(input, mapping);
             }
 
             // All other modes: default to `route` in the single inlet single outlet scenario
-            return route_single(std::move(input), mapping, index_type);
+            return route_single(input, mapping, index_type);
         }
 
         switch (mode) {
-            case RouterMode::through: return through_multi(std::move(input), mapping);
-            case RouterMode::merge: return merge(std::move(input), mapping, index_type);
-            case RouterMode::split: return split(std::move(input), mapping, index_type);
-            case RouterMode::mix: return mix(std::move(input), mapping, index_type);
-            case RouterMode::distribute: return distribute(std::move(input), mapping, index_type);
-            default: return route_multi(std::move(input), mapping, index_type);
+            case RouterMode::through: return through_multi(input, mapping);
+            case RouterMode::merge: return merge(input, mapping, index_type);
+            case RouterMode::split: return split(input, mapping, index_type);
+            case RouterMode::mix: return mix(input, mapping, index_type);
+            case RouterMode::distribute: return distribute(input, mapping, index_type);
+            default: return route_multi(input, mapping, index_type);
         }
     }
 
@@ -1001,47 +1001,49 @@ public:
     }
 
 private:
-    std::pair<MultiVoices<T>, RouterMapping> route_single(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> route_single(const MultiVoices<T>& input
                                                           , const Voices<Facet>& indices
                                                           , Index::Type index_type) {
-        auto& voices = input[0];
+        const auto& voices = input[0];
         auto num_incoming_voices = voices.size();
 
         auto route_mapping = Route::parse_route(indices, num_incoming_voices, std::nullopt, index_type, true);
-        auto output = route_mapping.apply_single(std::move(voices));
+        auto output = route_mapping.apply_single(voices);
 
         return {{output}, RouterMapping{route_mapping}};
     }
 
 
-    std::pair<MultiVoices<T>, RouterMapping> route_multi(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> route_multi(const MultiVoices<T>& input
                                                          , const Voices<Facet>& indices
                                                          , Index::Type index_type) {
         auto num_inlets = input.size();
 
         auto route_mapping = Route::parse_route(indices, num_inlets, num_outlets(), index_type, false);
-        auto output = route_mapping.apply_multi(std::move(input));
+        auto output = route_mapping.apply_multi(input);
 
         return {output, RouterMapping{route_mapping}};
     }
 
 
-    std::pair<MultiVoices<T>, RouterMapping> through_single(MultiVoices<T>&& input, const Voices<Facet>& boolean_mask) {
-        auto& voices = input[0];
+    std::pair<MultiVoices<T>, RouterMapping> through_single(const MultiVoices<T>& input
+                                                          , const Voices<Facet>& boolean_mask) {
+        const auto& voices = input[0];
         auto num_active_voices = std::min(voices.size(), boolean_mask.size());
 
         auto route_mapping = Route::parse_through(boolean_mask, num_active_voices, true);
-        auto output = route_mapping.apply_single(std::move(voices));
+        auto output = route_mapping.apply_single(voices);
 
         return {{output}, RouterMapping{route_mapping}};
     }
 
 
-    std::pair<MultiVoices<T>, RouterMapping> through_multi(MultiVoices<T>&& input, const Voices<Facet>& boolean_mask) {
+    std::pair<MultiVoices<T>, RouterMapping> through_multi(const MultiVoices<T>& input
+                                                         , const Voices<Facet>& boolean_mask) {
         auto num_active_outlets = std::min({input.size(), boolean_mask.size(), m_num_outlets});
 
         auto route_mapping = Route::parse_through(boolean_mask, num_active_outlets, false);
-        auto output = route_mapping.apply_multi(std::move(input));
+        auto output = route_mapping.apply_multi(input);
 
         return {output, RouterMapping{route_mapping}};
     }
@@ -1050,14 +1052,14 @@ private:
     /**
      * Note: if phase (is_index=false): value corresponds to relative voice count [0, 1) of that particular inlet
      */
-    std::pair<MultiVoices<T>, RouterMapping> merge(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> merge(const MultiVoices<T>& input
                                                    , const Voices<Facet>& counts
                                                    , Index::Type index_type) {
         auto num_active_inlets = std::min(input.size(), counts.size());
         auto voice_count_per_inlet = voice_counts(input);
 
         auto mapping = Merge::parse(counts, num_active_inlets, voice_count_per_inlet, index_type);
-        auto output = mapping.apply(std::move(input));
+        auto output = mapping.apply(input);
 
         return {output, RouterMapping{mapping}};
     }
@@ -1066,35 +1068,35 @@ private:
     /**
      * Note: if phase (is_index=false): corresponds to fraction of total voice count from inlet.
      */
-    std::pair<MultiVoices<T>, RouterMapping> split(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> split(const MultiVoices<T>& input
                                                    , const Voices<Facet>& counts
                                                    , Index::Type index_type) {
-        auto& voices = input[0];
+        const auto& voices = input[0];
         auto num_active_outlets = std::min(m_num_outlets, counts.size());
 
         auto mapping = Split::parse(counts, num_active_outlets, voices.size(), index_type);
-        auto output = mapping.apply(std::move(voices));
+        auto output = mapping.apply(voices);
 
         return {output, RouterMapping{mapping}};
     }
 
 
-    std::pair<MultiVoices<T>, RouterMapping> mix(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> mix(const MultiVoices<T>& input
                                                  , const Voices<Facet>& spec
                                                  , Index::Type index_type) {
         auto mapping = Mix::parse(spec, input, index_type);
-        auto output = mapping.apply(std::move(input));
+        auto output = mapping.apply(input);
 
         return {output, RouterMapping{mapping}};
     }
 
 
-    std::pair<MultiVoices<T>, RouterMapping> distribute(MultiVoices<T>&& input
+    std::pair<MultiVoices<T>, RouterMapping> distribute(const MultiVoices<T>& input
                                                         , const Voices<Facet>& spec
                                                         , Index::Type index_type) {
-        auto& voices = input[0];
+        const auto& voices = input[0];
         auto mapping = Distribute::parse(spec, voices, index_type);
-        auto output = mapping.apply(std::move(voices));
+        auto output = mapping.apply(voices);
 
         return {output, RouterMapping{mapping}};
     }
@@ -1136,7 +1138,7 @@ public:
     RouterBase(RouterBase&&) noexcept = default;
     RouterBase& operator=(RouterBase&&) noexcept = default;
 
-    virtual MultiVoices<T> process(MultiVoices<T>&& input
+    virtual MultiVoices<T> process(const MultiVoices<T>& input
                                    , const Voices<Facet>& spec
                                    , RouterMode mode
                                    , Index::Type index_type
@@ -1159,13 +1161,13 @@ public:
     FacetRouter(std::size_t num_inlets, std::size_t num_outlets): m_router(num_inlets, num_outlets) {}
 
 
-    MultiVoices<Facet> process(MultiVoices<Facet>&& input
+    MultiVoices<Facet> process(const MultiVoices<Facet>& input
                                , const Voices<Facet>& spec
                                , RouterMode mode
                                , Index::Type index_type
                                , FlushMode) override {
         // For Facet input, we simply discard the Mapping as we have no state to handle on flush
-        auto output = m_router.process(std::move(input), spec, mode, index_type).first;
+        auto output = m_router.process(input, spec, mode, index_type).first;
 
         return m_router.adjust_size(std::move(output));
     }
@@ -1198,7 +1200,7 @@ public:
     , m_held(num_outlets) {}
 
 
-    MultiVoices<Trigger> process(MultiVoices<Trigger>&& input
+    MultiVoices<Trigger> process(const MultiVoices<Trigger>& input
                                  , const Voices<Facet>& spec
                                  , RouterMode mode
                                  , Index::Type index_type
@@ -1226,7 +1228,7 @@ public:
         // - (d) we append our flushed dangling pulse offs at the _start_ of `output`
         //
 
-        auto [output, mapping] = m_router.process(std::move(input), spec, mode, index_type);
+        auto [output, mapping] = m_router.process(input, spec, mode, index_type);
 
         // Since MultiOutletHeldPulses cannot distinguish between a single voice with no output (Voices::empty_like)
         // and a completely empty output resulting from an empty mapping (Voices::empty_like too),
@@ -1298,6 +1300,7 @@ public:
                               .with_static_property(param::properties::template_class, Keys::CLASS_NAME)
                               , parent)
         , m_socket_handler(m_parameter_handler)
+        , m_time_gate(m_socket_handler.time_source())
         , m_inputs(std::move(inputs), m_socket_handler, Keys::INPUT)
         , m_routing_map(m_socket_handler.create_socket<Facet>(Keys::ROUTING_MAP, routing_map))
         , m_mode(m_socket_handler.create_socket<Facet>(Keys::MODE, mode))
@@ -1312,40 +1315,73 @@ public:
     }
 
 
-    void update_time(const TimePoint& t) override { m_time_gate.push_time(t); }
+    void update_time(const TimePoint& t) override { m_socket_handler.update_time(t); }
 
 
-    Vec<Voices<T>> process() override {
+    bool bind_time_frame(const TimeFrame* frame) override {
+        m_socket_handler.bind_time_frame(frame);
+        return true;
+    }
+
+
+    const Vec<Voices<T>>& process() override {
+        return process_internal();
+    }
+
+
+    Voices<T> process_outlet(std::size_t outlet) override {
+        const auto& outputs = process_internal();
+        if (outlet >= outputs.size())
+            return Voices<T>::empty_like();
+        return outputs[outlet];
+    }
+
+
+    std::vector<Generative*> get_connected() override { return m_socket_handler.get_connected(); }
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+    void disconnect_if(Generative& connected_to) override { m_socket_handler.disconnect_if(connected_to); }
+
+
+    std::vector<std::pair<std::string, Generative*>> get_connections() override {
+        return m_socket_handler.get_connections();
+    }
+
+
+    bool try_connect(const std::string& socket_id, Generative& generative) override {
+        return m_socket_handler.try_connect(socket_id, generative);
+    }
+
+
+    std::vector<ConnectionSlot*> get_connection_slots() override { return m_socket_handler.get_connection_slots(); }
+
+private:
+    /** Processes the router once per cycle. Subsequent calls within the same cycle return the stored value */
+    const MultiVoices<T>& process_internal() {
         if (auto t = m_time_gate.pop_time(); !t) {
             return m_current_value;
         }
 
         if (auto flushed = process_enabled_state()) {
-            m_current_value = *flushed;
+            m_current_value = std::move(*flushed);
             return m_current_value;
         }
 
-        auto mode = m_mode.process().first_or(RouterDefaults::MODE);
-        auto uses_index = m_uses_index.process().first_or(RouterDefaults::USE_INDEX);
-        auto flush_mode = m_flush_mode.process().first_or(RouterDefaults::FLUSH_MODE);
+        auto mode = m_mode.read()->first_or(RouterDefaults::MODE);
+        auto uses_index = m_uses_index.read()->first_or(RouterDefaults::USE_INDEX);
+        auto flush_mode = m_flush_mode.read()->first_or(RouterDefaults::FLUSH_MODE);
 
         auto index_type = uses_index ? Index::Type::index : Index::Type::phase;
 
-        auto input = m_inputs.process();
-        auto routing_map = m_routing_map.process();
+        const auto& input = m_inputs.process();
+        auto routing_map = m_routing_map.read();
 
         assert(input.size() == m_router->num_inlets());
 
-        m_current_value = m_router->process(std::move(input), routing_map, mode, index_type, flush_mode);
+        m_current_value = m_router->process(input, *routing_map, mode, index_type, flush_mode);
         return m_current_value;
     }
 
 
-    std::vector<Generative*> get_connected() override { return m_socket_handler.get_connected(); }
-    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
-    void disconnect_if(Generative& connected_to) override { m_socket_handler.disconnect_if(connected_to); }
-
-private:
     std::optional<MultiVoices<T>> process_enabled_state() {
         if constexpr (IS_TRIGGER) {
             if (auto state = m_enabled_gate.update(is_enabled()); state == EnabledState::disabled_this_cycle) {
@@ -1366,7 +1402,7 @@ private:
 
 
     bool is_enabled() {
-        return m_enabled.process().first_or(true) && m_inputs.any_is_connected() && m_routing_map.is_connected();
+        return m_enabled.read()->first_or(true) && m_inputs.any_is_connected() && m_routing_map.is_connected();
     }
 
 
@@ -56,7 +56,7 @@ public:
         , m_hold_state(add_socket(Keys::HOLD_STATE, hold_state)) {}
 
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         if (!pop_time()) {
             return m_current_value;
         }
@@ -66,30 +66,30 @@ public:
             return m_current_value;
         }
 
-        auto input_value = m_input_value.process();
-        auto hold_state = m_hold_state.process();
+        auto input_value = m_input_value.read();
+        auto hold_state = m_hold_state.read();
 
-        auto num_voices = voice_count(input_value.size(), hold_state.size());
+        auto num_voices = voice_count(input_value->size(), hold_state->size());
 
         if (num_voices != m_snh.size()) {
             m_snh.resize(num_voices);
         }
 
-        auto in = input_value.adapted_to(num_voices).as_type<double>();
+        auto in = input_value->as_type<double>();
+        in.adapted_to(num_voices);
         auto is_closed = hold_state
-                .adapted_to(num_voices)
-                .as_type<bool>([](const Facet& f) {
+                ->as_type<bool>([](const Facet& f) {
                     return utils::equals(static_cast<double>(f), SampleAndHold::STATE_CLOSED);
                 })
-                .firsts_or(false);
+                .adapted_firsts_or(num_voices, false);
 
         auto output = Voices<Facet>::zeros(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
             output[i] = m_snh[i].process(std::move(in[i]), is_closed[i]).as_type<Facet>();
         }
 
-        m_current_value = output;
-        return output;
+        m_current_value = std::move(output);
+        return m_current_value;
     }
 
 private:
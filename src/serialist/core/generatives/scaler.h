@@ -25,12 +25,13 @@ public:
         if (utils::equals(input_low, input_high))
             return Voice<Facet>::repeated(values.size(), Facet{input_low * (output_high - output_low) + output_low});
 
-        return values.as_type<double>()
-                .clip(input_low, input_high)
+        // Facets are processed in place as doubles (see `utils::is_double_like`)
+        auto output = values.cloned();
+        output.clip(Facet(input_low), Facet(input_high))
                 .divide(input_high - input_low)
                 .multiply(output_high - output_low)
-                .add(output_low)
-                .as_type<Facet>();
+                .add(output_low);
+        return output;
     }
 };
 
@@ -67,7 +68,10 @@ public:
     , m_output_high(add_socket(Keys::OUTPUT_HIGH, output_high)) {}
 
 
-    Voices<Facet> process() override {
+    bool is_time_dependent() const override { return false; }
+
+
+    const Voices<Facet>& process() override {
         if (!pop_time()) return m_current_value;
 
         if (!is_enabled() || !m_trigger.is_connected() || !m_value.is_connected()) {
@@ -75,26 +79,29 @@ public:
             return m_current_value;
         }
 
-        if (m_trigger.process().is_empty_like())
+        if (m_trigger.read()->is_empty_like())
             return m_current_value;
 
-        auto value = m_value.process();
-        auto input_low = m_input_low.process();
-        auto input_high = m_input_high.process();
-        auto output_low = m_output_low.process();
-        auto output_high = m_output_high.process();
+        auto value = m_value.read();
+        auto input_low = m_input_low.read();
+        auto input_high = m_input_high.read();
+        auto output_low = m_output_low.read();
+        auto output_high = m_output_high.read();
 
-        auto num_voices = voice_count(value.size(), input_low.size(), input_high.size(), output_low.size(), output_high.size());
+        auto num_voices = voice_count(value->size(), input_low->size(), input_high->size(), output_low->size(), output_high->size());
 
-        auto values = value.adapted_to(num_voices);
-        auto input_lows = input_low.adapted_to(num_voices).firsts_or(Scaler::DEFAULT_INPUT_LOW);
-        auto input_highs = input_high.adapted_to(num_voices).firsts_or(Scaler::DEFAULT_INPUT_HIGH);
-        auto output_lows = output_low.adapted_to(num_voices).firsts_or(Scaler::DEFAULT_OUTPUT_LOW);
-        auto output_highs = output_high.adapted_to(num_voices).firsts_or(Scaler::DEFAULT_OUTPUT_HIGH);
+        auto input_lows = input_low->adapted_firsts_or(num_voices, Scaler::DEFAULT_INPUT_LOW);
+        auto input_highs = input_high->adapted_firsts_or(num_voices, Scaler::DEFAULT_INPUT_HIGH);
+        auto output_lows = output_low->adapted_firsts_or(num_voices, Scaler::DEFAULT_OUTPUT_LOW);
+        auto output_highs = output_high->adapted_firsts_or(num_voices, Scaler::DEFAULT_OUTPUT_HIGH);
 
         auto output = Voices<Facet>::zeros(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
-            output[i] = Scaler::scale(values[i], input_lows[i], input_highs[i], output_lows[i], output_highs[i]);
+            output[i] = Scaler::scale(value->adapted_at(i)
+                                      , input_lows[i]
+                                      , input_highs[i]
+                                      , output_lows[i]
+                                      , output_highs[i]);
         }
 
         m_current_value = std::move(output);
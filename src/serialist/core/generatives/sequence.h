@@ -36,7 +36,7 @@ public:
             : Sequence(id, parent, Voices<StoredType>::singular(value)) {}
 
 
-    Voices<OutputType> process() override {
+    const Voices<OutputType>& process() override {
         return m_sequence.get_voices();
     }
 
@@ -51,6 +51,9 @@ public:
     }
 
 
+    bool bind_time_frame(const TimeFrame*) override { return true; /* independent of time */ }
+
+
     Voices<OutputType> get_values() {
         return m_sequence.get_voices();
     }
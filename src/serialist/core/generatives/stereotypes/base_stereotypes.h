@@ -20,7 +20,7 @@ public:
 
     template<std::size_t max_count = 128, typename... Args>
     static std::size_t voice_count(Socket<Facet>& voices_count_socket, Args... args) {
-        auto num_voices = static_cast<long>(voices_count_socket.process().adapted_to(1).first_or(0));
+        auto num_voices = static_cast<long>(voices_count_socket.read()->first_or(0));
         if (num_voices <= 0) {
             return std::min(max_count, std::max({static_cast<std::size_t>(1), args...}));
         }
@@ -53,12 +53,37 @@ public:
 
     void disconnect_if(Generative& connected_to) override { m_socket_handler.disconnect_if(connected_to); }
 
+
+    std::vector<std::pair<std::string, Generative*>> get_connections() override {
+        return m_socket_handler.get_connections();
+    }
+
+
+    bool try_connect(const std::string& socket_id, Generative& generative) override {
+        return m_socket_handler.try_connect(socket_id, generative);
+    }
+
+
+    std::vector<ConnectionSlot*> get_connection_slots() override { return m_socket_handler.get_connection_slots(); }
+
+
+    void update_time(const TimePoint& t) override { m_socket_handler.update_time(t); }
+
+
+    bool bind_time_frame(const TimeFrame* frame) override {
+        m_socket_handler.bind_time_frame(frame);
+        return true;
+    }
+
 protected:
     template<typename OutputType>
     Socket<OutputType>& add_socket(const std::string& id, Node<OutputType>* initial = nullptr) {
         return m_socket_handler.create_socket(id, initial);
     }
 
+
+    const TimeFrameSource& time_source() const { return m_socket_handler.time_source(); }
+
 private:
     ParameterHandler m_parameter_handler;
     SocketHandler m_socket_handler;
@@ -88,12 +113,37 @@ public:
 
     void disconnect_if(Generative& connected_to) override { m_socket_handler.disconnect_if(connected_to); }
 
+
+    std::vector<std::pair<std::string, Generative*>> get_connections() override {
+        return m_socket_handler.get_connections();
+    }
+
+
+    bool try_connect(const std::string& socket_id, Generative& generative) override {
+        return m_socket_handler.try_connect(socket_id, generative);
+    }
+
+
+    std::vector<ConnectionSlot*> get_connection_slots() override { return m_socket_handler.get_connection_slots(); }
+
+
+    void update_time(const TimePoint& t) override { m_socket_handler.update_time(t); }
+
+
+    bool bind_time_frame(const TimeFrame* frame) override {
+        m_socket_handler.bind_time_frame(frame);
+        return true;
+    }
+
 protected:
     template<typename OutputType>
     Socket<OutputType>& add_socket(const std::string& id, Node<OutputType>* initial = nullptr) {
         return m_socket_handler.create_socket(id, initial);
     }
 
+
+    const TimeFrameSource& time_source() const { return m_socket_handler.time_source(); }
+
 private:
     ParameterHandler m_parameter_handler;
     SocketHandler m_socket_handler;
@@ -112,10 +162,8 @@ public:
              , const std::string& class_name)
         : StaticNode<T>(id, parent, class_name)
         , m_enabled(StaticNode<T>::add_socket(param::properties::enabled, enabled))
-        , m_num_voices(StaticNode<T>::add_socket(param::properties::num_voices, num_voices)) {}
-
-
-    void update_time(const TimePoint& t) override { m_time_gate.push_time(t); }
+        , m_num_voices(StaticNode<T>::add_socket(param::properties::num_voices, num_voices))
+        , m_time_gate(StaticNode<T>::time_source()) {}
 
 
     void set_enabled(Node<Facet>* enabled) { m_enabled = enabled; }
@@ -130,11 +178,12 @@ public:
     Socket<Facet>& get_num_voices() { return m_num_voices; }
 
 protected:
-    std::optional<TimePoint> pop_time() { return m_time_gate.pop_time(); }
+    /** @return the time of the current cycle the first time it's called in each cycle, otherwise nullptr */
+    const TimePoint* pop_time() { return m_time_gate.pop_time(); }
 
 
     bool is_enabled() {
-        return m_enabled.process().first_or(true);
+        return m_enabled.read()->first_or(true);
     }
 
 
@@ -150,10 +199,10 @@ protected:
 
 
     template<typename InputType, typename OutputType>
-    static Vec<OutputType> adapted(Voices<InputType>&& values
+    static Vec<OutputType> adapted(const Voices<InputType>& values
                                    , std::size_t num_voices
                                    , const OutputType& default_value) {
-        return values.adapted_to(num_voices).firsts_or(default_value);
+        return values.adapted_firsts_or(num_voices, default_value);
     }
 
 private:
@@ -181,14 +230,14 @@ public:
     }
 
 
-    Voices<Trigger> process() final {
+    const Voices<Trigger>& process() final {
         auto t = pop_time();
         if (!t) // process has already been called this cycle
             return m_current_value;
 
         bool enabled = is_enabled(*t);
         auto enabled_state = m_enabled_gate.update(enabled);
-        auto should_flush = Trigger::contains_pulse_on(m_flush.process());
+        auto should_flush = Trigger::contains_pulse_on(*m_flush.read());
         if (auto flushed = handle_enabled_state(enabled_state, should_flush)) {
             // Note: this should never be flushed unless the node is disabled,
             //       so this value will always be returned in the next statement
@@ -28,7 +28,7 @@ public:
         , m_value(add_socket(Keys::VALUE, value)) {}
 
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         if (!pop_time()) return m_current_value;
 
         if (!is_enabled() || !m_trigger.is_connected() || !m_value.is_connected()) {
@@ -36,24 +36,21 @@ public:
             return m_current_value;
         }
 
-        auto trigger = m_trigger.process();
+        auto trigger = m_trigger.read();
 
-        if (trigger.is_empty_like()) {
+        if (trigger->is_empty_like()) {
             return m_current_value;
         }
 
-        auto value = m_value.process();
+        auto value = m_value.read();
 
-        auto num_voices = voice_count(value.size(), trigger.size());
-
-        auto values = value.adapted_to(num_voices);
-        auto triggers = trigger.adapted_to(num_voices);
+        auto num_voices = voice_count(value->size(), trigger->size());
 
         // operating directly on m_current_value to preserve values from previous cycles
         m_current_value.adapted_to(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
-            if (Trigger::contains_pulse_on(triggers[i])) {
-                m_current_value[i] = values[i];
+            if (Trigger::contains_pulse_on(trigger->adapted_at(i))) {
+                m_current_value[i] = value->adapted_at(i);
             }
         }
 
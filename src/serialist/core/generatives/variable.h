@@ -31,14 +31,27 @@ public:
     }
 
 
-    Voices<OutputType> process() override {
-        return Voices<OutputType>::singular(static_cast<OutputType>(m_value.get()));
+    const Voices<OutputType>& process() override {
+        auto value = m_value.get();
+
+        // only rebuilt when the value changes, as the previous output is returned by reference
+        if constexpr (utils::is_equality_comparable_v<StoredType>) {
+            if (m_stored_value && *m_stored_value == value)
+                return m_current_value;
+            m_stored_value = value;
+        }
+
+        m_current_value = Voices<OutputType>::singular(static_cast<OutputType>(value));
+        return m_current_value;
     }
 
 
     void disconnect_if(Generative&) override { /* unused */ }
 
 
+    bool bind_time_frame(const TimeFrame*) override { return true; /* independent of time */ }
+
+
     StoredType get_value() { return m_value.get(); }
 
 
@@ -60,6 +73,8 @@ private:
 
     ParameterType m_value;
 
+    std::optional<StoredType> m_stored_value = std::nullopt;
+    Voices<OutputType> m_current_value = Voices<OutputType>::empty_like();
 };
 
 } // namespace serialist
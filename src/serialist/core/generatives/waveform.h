@@ -122,7 +122,7 @@ public:
         , m_phase(add_socket(Keys::PHASE, phase)) {}
 
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         if (!pop_time()) {
             return m_current_value;
         }
@@ -132,30 +132,29 @@ public:
             return m_current_value;
         }
 
-        auto trigger = m_trigger.process();
-        if (trigger.is_empty_like())
+        auto trigger = m_trigger.read();
+        if (trigger->is_empty_like())
             return m_current_value;
 
-        auto mode = m_mode.process();
-        auto duty = m_duty.process();
-        auto curve = m_curve.process();
-        auto phase = m_phase.process();
+        auto mode = m_mode.read();
+        auto duty = m_duty.read();
+        auto curve = m_curve.read();
+        auto phase = m_phase.read();
 
-        auto num_voices = voice_count(trigger.size(), mode.size(), duty.size(), curve.size(), phase.size());
+        auto num_voices = voice_count(trigger->size(), mode->size(), duty->size(), curve->size(), phase->size());
 
         if (num_voices != m_waveforms.size()) {
             m_waveforms.resize(num_voices);
         }
 
-        auto triggers = trigger.adapted_to(num_voices);
-        auto modes = mode.adapted_to(num_voices).firsts_or(Waveform::DEFAULT_MODE);
-        auto duties = duty.adapted_to(num_voices).firsts_or(Waveform::DEFAULT_DUTY);
-        auto curves = curve.adapted_to(num_voices).firsts_or(Waveform::DEFAULT_CURVE);
-        auto phases = phase.adapted_to(num_voices).firsts();
+        auto modes = mode->adapted_firsts_or(num_voices, Waveform::DEFAULT_MODE);
+        auto duties = duty->adapted_firsts_or(num_voices, Waveform::DEFAULT_DUTY);
+        auto curves = curve->adapted_firsts_or(num_voices, Waveform::DEFAULT_CURVE);
+        auto phases = phase->adapted_firsts(num_voices);
 
         m_current_value.adapted_to(num_voices);
         for (std::size_t i = 0; i < num_voices; ++i) {
-            if (phases[i].has_value() && Trigger::contains_pulse_on(triggers[i])) {
+            if (phases[i].has_value() && Trigger::contains_pulse_on(trigger->adapted_at(i))) {
                 auto f = Facet{m_waveforms[i].process(phases[i].value(), modes[i], duties[i], curves[i])};
                 m_current_value[i] = Voice<Facet>::singular(f);
             }
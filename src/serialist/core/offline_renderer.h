@@ -0,0 +1,181 @@
+
+#ifndef SERIALIST_OFFLINE_RENDERER_H
+#define SERIALIST_OFFLINE_RENDERER_H
+
+#include <map>
+#include <unordered_set>
+#include "core/generation_graph.h"
+#include "core/policies/epsilon.h"
+#include "core/collections/vec.h"
+#include "core/types/event.h"
+#include "core/types/meter.h"
+#include "core/types/time_point.h"
+
+namespace serialist {
+
+/**
+ * @brief Renders a GenerationGraph faster than realtime by advancing time in fixed steps without a clock.
+ *
+ * Every step processes the graph once and collects the (non-empty) output of all registered output nodes
+ * into a timestamped buffer.
+ */
+template<typename T = Event>
+class OfflineRenderer {
+public:
+    struct RenderedOutput {
+        TimePoint time;
+        std::size_t output_index;
+        Voices<T> voices;
+    };
+
+
+    /**
+     * @throw std::invalid_argument if `step_size` is not positive or `tempo` is not positive
+     */
+    OfflineRenderer(GenerationGraph& graph
+                    , const DomainDuration& step_size
+                    , const Meter& initial_meter = Meter()
+                    , double initial_tempo = 120.0)
+            : m_graph(graph)
+            , m_step_size(step_size)
+            , m_initial_meter(initial_meter)
+            , m_initial_tempo(initial_tempo) {
+        if (step_size.get_value() <= 0.0)
+            throw std::invalid_argument("Step size must be > 0");
+        if (initial_tempo <= 0.0)
+            throw std::invalid_argument("Tempo must be > 0");
+    }
+
+
+    /**
+     * Observes `node` in the graph, keeping it live even if it isn't reachable from any root.
+     * @throw std::invalid_argument if `node` isn't part of the graph
+     * @return index of the output, used to identify its events in the rendered buffer
+     */
+    std::size_t add_output(Node<T>& node) {
+        m_graph.observe(node);
+        m_outputs.push_back(&node);
+        return m_outputs.size() - 1;
+    }
+
+
+    /** Adds all nodes in the graph with output type T whose output isn't consumed by any other generative */
+    void add_terminal_outputs() {
+        const auto& generatives = m_graph.get_generatives();
+
+        std::unordered_set<const Generative*> consumed;
+        for (const auto& generative: generatives) {
+            for (auto* connected: generative->get_connected()) {
+                consumed.insert(connected);
+            }
+        }
+
+        for (const auto& generative: generatives) {
+            if (auto* node = node_cast<T>(generative.get()); node && consumed.count(node) == 0)
+                add_output(*node);
+        }
+    }
+
+
+    /** Changes the meter at the start of `bar`. Overrides any meter change previously scheduled at the same bar */
+    void schedule_meter_change(std::size_t bar, const Meter& meter) {
+        m_meter_changes[bar] = meter;
+    }
+
+
+    /** Changes the tempo at the first step at or after `time` */
+    void schedule_tempo_change(const DomainTimePoint& time, double tempo) {
+        if (tempo <= 0.0)
+            throw std::invalid_argument("Tempo must be > 0");
+        m_tempo_changes.emplace_back(time, tempo);
+    }
+
+
+    /**
+     * Renders the interval [start, end). Note that the graph is processed with consecutive time points from `start`,
+     * meaning that any state in the graph is preserved between successive calls.
+     */
+    Vec<RenderedOutput> render(const DomainTimePoint& start, const DomainTimePoint& end) {
+        auto origin = TimePoint(0.0, m_initial_tempo).with_meter(m_initial_meter);
+        auto t = TimePoint(start.as_type(DomainType::ticks, origin).get_value(), m_initial_tempo)
+                .with_meter(m_initial_meter);
+
+        auto meter_changes = m_meter_changes;
+        auto tempo_changes = m_tempo_changes;
+
+        // meter changes at or before the start bar have already occurred
+        while (!meter_changes.empty() && static_cast<double>(meter_changes.begin()->first) <= t.get_bar()) {
+            t.with_meter(meter_changes.begin()->second);
+            meter_changes.erase(meter_changes.begin());
+        }
+
+        Vec<RenderedOutput> rendered;
+
+        while (!has_reached(t, end)) {
+            apply_tempo_changes(t, tempo_changes);
+
+            m_graph.process(t);
+
+            for (std::size_t i = 0; i < m_outputs.size(); ++i) {
+                // The output was evaluated in the graph cycle above: processing it again only returns its current value
+                auto voices = m_outputs[i]->process();
+                if (!voices.is_empty_like())
+                    rendered.append(RenderedOutput{t, i, std::move(voices)});
+            }
+
+            increment(t, meter_changes);
+        }
+
+        return rendered;
+    }
+
+
+    const std::vector<Node<T>*>& get_outputs() const { return m_outputs; }
+
+
+private:
+    /** Tolerant version of DomainTimePoint::elapsed, as bars and beats accumulate rounding errors over many steps */
+    static bool has_reached(const TimePoint& t, const DomainTimePoint& target) {
+        return t.get(target.get_type()) >= target.get_value() - EPSILON;
+    }
+
+
+    void increment(TimePoint& t, std::map<std::size_t, Meter>& meter_changes) const {
+        if (meter_changes.empty() || meter_changes.begin()->first > t.next_bar()) {
+            t.increment(m_step_size);
+            return;
+        }
+
+        if (t.increment_with_meter_change(m_step_size, meter_changes.begin()->second)) {
+            meter_changes.erase(meter_changes.begin());
+        }
+    }
+
+
+    static void apply_tempo_changes(TimePoint& t, std::vector<std::pair<DomainTimePoint, double>>& tempo_changes) {
+        for (auto it = tempo_changes.begin(); it != tempo_changes.end();) {
+            if (has_reached(t, it->first)) {
+                t.with_tempo(it->second);
+                it = tempo_changes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+
+    GenerationGraph& m_graph;
+
+    DomainDuration m_step_size;
+    Meter m_initial_meter;
+    double m_initial_tempo;
+
+    std::vector<Node<T>*> m_outputs;
+
+    std::map<std::size_t, Meter> m_meter_changes;
+    std::vector<std::pair<DomainTimePoint, double>> m_tempo_changes;
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_OFFLINE_RENDERER_H
@@ -10,7 +10,9 @@ template<typename T>
 class MultiSocket {
 public:
     MultiSocket(Vec<Node<T>*> nodes, SocketHandler& socket_handler, const std::string& base_name)
-        : m_sockets{create_sockets(std::move(nodes), socket_handler, base_name)} {
+        : m_sockets{create_sockets(std::move(nodes), socket_handler, base_name)}
+        , m_values(Vec<Voices<T>>::repeated(m_sockets.size(), Voices<T>::empty_like()))
+        , m_sources(Vec<SharedVoices<T>>::repeated(m_sockets.size(), SharedVoices<T>{})) {
         assert(!m_sockets.empty());
     }
 
@@ -27,12 +29,20 @@ public:
     }
 
 
-    Vec<Voices<T>> process() {
-        auto result = Vec<Voices<T>>::allocated(m_sockets.size());
-        for (const auto& socket : m_sockets) {
-            result.append(socket.get().process());
+    /**
+     * @return the current value of every inlet. The buffer is reused between calls: an inlet is only copied when
+     *         its socket returns a different output buffer than in the previous call, i.e. not at all for inlets
+     *         whose node output didn't change within a GenerationGraph cycle
+     */
+    const Vec<Voices<T>>& process() {
+        for (std::size_t i = 0; i < m_sockets.size(); ++i) {
+            auto value = m_sockets[i].get().read();
+            if (value != m_sources[i]) {
+                m_values[i] = *value;
+                m_sources[i] = std::move(value);
+            }
         }
-        return result;
+        return m_values;
     }
 
 
@@ -51,6 +61,9 @@ public:
 private:
     Vec<std::reference_wrapper<Socket<T>>> m_sockets;
 
+    Vec<Voices<T>> m_values;
+    Vec<SharedVoices<T>> m_sources; // buffers that `m_values` were copied from, held to keep their identity unique
+
 };
 
 }
@@ -5,6 +5,7 @@
 
 
 #include <iostream>
+#include <regex>
 #include "core/exceptions.h"
 #include "core/collections/voices.h"
 #include "parameter_keys.h"
@@ -14,9 +15,11 @@ namespace serialist {
 class NopParameterHandler {
 public:
     // Public ctor, signature to match VTParameterHandler
-    explicit NopParameterHandler(const Specification&, NopParameterHandler&) {}
+    explicit NopParameterHandler(const Specification& specification, NopParameterHandler&)
+            : m_id(identifier_of(specification)) {}
 
-    [[deprecated]] NopParameterHandler(const std::string&, NopParameterHandler&, const std::string& = "") {}
+    [[deprecated]] NopParameterHandler(const std::string& id, NopParameterHandler&, const std::string& = "")
+            : m_id(id) {}
 
 
     NopParameterHandler() = default;
@@ -26,6 +29,35 @@ public:
     void add_static_property(const std::string&, T) { /* unused*/} // signature to match VTParameterHandler
 
 
+    const std::string& get_id() const { return m_id; }
+
+
+    /**
+     * matches, e.g. `base_name` "osc" matches identifiers "osc", "osc::freq", "osc::freq::value" but not "osc1"
+     */
+    bool identifier_matches(const std::string& base_name) const {
+        return identifier_matches(std::regex("^" + base_name + "(:{2}.*)?$"));
+    }
+
+
+    bool identifier_matches(const std::regex& base_name_regex) const {
+        return std::regex_match(m_id, base_name_regex);
+    }
+
+
+    bool identifier_equals(const std::string& exact_name) const { return m_id == exact_name; }
+
+private:
+    static std::string identifier_of(const Specification& specification) {
+        for (const auto& [property_name, property_value]: specification.static_properties()) {
+            if (property_name == param::properties::identifier)
+                return property_value;
+        }
+        return "";
+    }
+
+
+    std::string m_id;
 };
 
 
@@ -0,0 +1,257 @@
+
+#ifndef SERIALIST_PARAMETER_CHANGE_QUEUE_H
+#define SERIALIST_PARAMETER_CHANGE_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace serialist {
+
+/**
+ * @brief Bounded lock-free multi-producer single-consumer queue of parameter changes.
+ *
+ * Any number of threads (e.g. GUI, OSC or MIDI threads) may push changes concurrently, while a single consumer
+ * (typically `GenerationGraph::process`) applies them in the order they were pushed. Neither side ever blocks:
+ * a change that hasn't been fully pushed when the consumer reaches it is applied on the consumer's next call,
+ * along with every change pushed after it.
+ *
+ * Neither side allocates either: changes are stored inline in preallocated cells (see `Change`). An applied change is
+ * kept in its cell until a producer reuses the cell, meaning that its captures are destroyed by a producer rather
+ * than by the consumer, which therefore never returns memory captured by a change to the global allocator.
+ */
+class ParameterChangeQueue {
+public:
+    /**
+     * @brief Move-only callable stored inline, e.g. a lambda capturing a generative along with the values to set.
+     *
+     * Accepts any callable of at most `CAPACITY` bytes that is nothrow move constructible. Larger data should be
+     * captured through a (smart) pointer.
+     */
+    class Change {
+    public:
+        static constexpr std::size_t CAPACITY = 64;
+
+
+        Change() = default;
+
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Change> > >
+        Change(F&& f) { // NOLINT(google-explicit-constructor)
+            using Callable = std::decay_t<F>;
+            static_assert(std::is_invocable_v<Callable&>, "Change must be callable without arguments");
+            static_assert(sizeof(Callable) <= CAPACITY, "Change exceeds Change::CAPACITY, capture a pointer instead");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Change is over-aligned");
+            static_assert(std::is_nothrow_move_constructible_v<Callable>, "Change must be nothrow movable");
+
+            ::new(static_cast<void*>(m_storage)) Callable(std::forward<F>(f));
+            m_operations = &OPERATIONS<Callable>;
+        }
+
+
+        Change(Change&& other) noexcept { take(other); }
+
+
+        Change& operator=(Change&& other) noexcept {
+            if (this != &other) {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+
+
+        Change(const Change&) = delete;
+        Change& operator=(const Change&) = delete;
+
+
+        ~Change() { reset(); }
+
+
+        void operator()() { m_operations->invoke(m_storage); }
+
+
+        explicit operator bool() const noexcept { return m_operations != nullptr; }
+
+
+        void reset() noexcept {
+            if (m_operations) {
+                m_operations->destroy(m_storage);
+                m_operations = nullptr;
+            }
+        }
+
+    private:
+        struct Operations {
+            void (* invoke)(void*);
+            void (* relocate)(void* from, void* to) noexcept;
+            void (* destroy)(void*) noexcept;
+        };
+
+
+        template<typename Callable>
+        static void invoke(void* callable) { (*static_cast<Callable*>(callable))(); }
+
+
+        template<typename Callable>
+        static void relocate(void* from, void* to) noexcept {
+            ::new(to) Callable(std::move(*static_cast<Callable*>(from)));
+            static_cast<Callable*>(from)->~Callable();
+        }
+
+
+        template<typename Callable>
+        static void destroy(void* callable) noexcept { static_cast<Callable*>(callable)->~Callable(); }
+
+
+        template<typename Callable>
+        static constexpr Operations OPERATIONS{&invoke<Callable>, &relocate<Callable>, &destroy<Callable>};
+
+
+        void take(Change& other) noexcept {
+            if (other.m_operations) {
+                other.m_operations->relocate(other.m_storage, m_storage);
+                m_operations = other.m_operations;
+                other.m_operations = nullptr;
+            }
+        }
+
+
+        const Operations* m_operations = nullptr;
+        alignas(std::max_align_t) unsigned char m_storage[CAPACITY];
+    };
+
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+
+    /** Capacity is rounded up to the nearest power of two */
+    explicit ParameterChangeQueue(std::size_t capacity = DEFAULT_CAPACITY)
+            : m_cells(round_up_to_power_of_two(capacity))
+            , m_mask(m_cells.size() - 1) {
+        for (std::size_t i = 0; i < m_cells.size(); ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+
+    ParameterChangeQueue(const ParameterChangeQueue&) = delete;
+    ParameterChangeQueue& operator=(const ParameterChangeQueue&) = delete;
+    ParameterChangeQueue(ParameterChangeQueue&&) noexcept = delete;
+    ParameterChangeQueue& operator=(ParameterChangeQueue&&) noexcept = delete;
+
+
+    /**
+     * Lock-free, may be called concurrently from any number of threads. Destroys the change previously applied from
+     * the cell `change` is stored in, if any.
+     *
+     * @return false if the queue is full, in which case `change` is discarded
+     */
+    bool push(Change change) {
+        auto position = m_push_position.load(std::memory_order_relaxed);
+
+        while (true) {
+            auto& cell = m_cells[position & m_mask];
+            auto sequence = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (diff == 0) {
+                // cell is free: claim it, unless another producer got there first
+                if (m_push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.change = std::move(change);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // cell still holds a change from the previous lap that hasn't been applied
+                return false;
+            } else {
+                position = m_push_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+
+    /**
+     * Applies pending changes in the order they were pushed. Changes pushed while applying may be deferred to the
+     * next call, as at most `capacity()` changes are applied per call.
+     * Must not be called concurrently from multiple threads.
+     *
+     * A change throwing an exception is dropped (see `num_failed`), and doesn't prevent later changes from being
+     * applied, as there's no caller on the consumer's side that could meaningfully handle it.
+     *
+     * @return number of changes applied, including failed ones
+     */
+    std::size_t apply_pending() noexcept {
+        std::size_t num_applied = 0;
+
+        while (num_applied < m_cells.size()) {
+            auto& cell = m_cells[m_pop_position & m_mask];
+            if (cell.sequence.load(std::memory_order_acquire) != m_pop_position + 1)
+                break;
+
+            try {
+                cell.change();
+            } catch (...) {
+                m_num_failed.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // releases the cell to producers of the next lap, which destroy the applied change
+            cell.sequence.store(m_pop_position + m_cells.size(), std::memory_order_release);
+            ++m_pop_position;
+            ++num_applied;
+
+            m_num_applied.store(m_pop_position, std::memory_order_release);
+        }
+
+        return num_applied;
+    }
+
+
+    /** @return number of changes pushed (or being pushed) since construction */
+    std::size_t num_pushed() const { return m_push_position.load(std::memory_order_acquire); }
+
+
+    /** @return number of changes that have been applied and returned since construction */
+    std::size_t num_applied() const { return m_num_applied.load(std::memory_order_acquire); }
+
+
+    /** @return number of changes that threw an exception when applied since construction */
+    std::size_t num_failed() const { return m_num_failed.load(std::memory_order_relaxed); }
+
+
+    std::size_t capacity() const { return m_cells.size(); }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        Change change;
+    };
+
+
+    static std::size_t round_up_to_power_of_two(std::size_t n) {
+        std::size_t power = 2;
+        while (power < n) {
+            power <<= 1;
+        }
+        return power;
+    }
+
+
+    std::vector<Cell> m_cells;
+    const std::size_t m_mask;
+
+    // producers and consumer on separate cache lines, as they're written by different threads
+    alignas(64) std::atomic<std::size_t> m_push_position{0};
+    alignas(64) std::size_t m_pop_position = 0;
+    std::atomic<std::size_t> m_num_applied{0};
+    std::atomic<std::size_t> m_num_failed{0};
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_PARAMETER_CHANGE_QUEUE_H
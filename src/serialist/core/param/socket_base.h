@@ -2,13 +2,24 @@
 #ifndef SERIALISTLOOPER_SOCKET_BASE_H
 #define SERIALISTLOOPER_SOCKET_BASE_H
 
-#include <mutex>
+#include <atomic>
+#include <optional>
+#include <utility>
 #include "core/connectable.h"
 #include "core/generative.h"
 #include "core/param/parameter_keys.h"
+#include "core/temporal/time_gate.h"
 
 namespace serialist {
 
+/**
+ * @brief Connection from a generative to a `Node<T>`.
+ *
+ * The read path (`process`, `read`, `has_changed`, `voice_count`) is lock-free and must only be called from the
+ * processing thread. Connections may be changed from any thread, and are stored in a `ConnectionSlot`: a standalone
+ * socket picks up the new connection on its next read, whereas a socket of a generative in a `GenerationGraph` only
+ * does so once the graph has applied it between two cycles.
+ */
 template<typename T>
 class SocketBase : public Connectable {
 public:
@@ -18,58 +29,82 @@ public:
     }
 
     explicit SocketBase(Node<T>* initial = nullptr)
-            : m_node(initial) {}
+            : m_slot(initial) {}
 
 
+    /** @return a copy of the connected node's output, for consumers that need to modify the value */
     Voices<T> process() {
-        std::lock_guard lock{m_mutex};
-        auto v = process_internal();
-        m_previous_value = v;
-        return v;
+        return *read();
     }
 
 
+    /**
+     * @return the connected node's output without copying it. Within a GenerationGraph cycle, this is the buffer
+     *         stored by the node, shared with all other sockets reading the same node
+     */
+    SharedVoices<T> read() {
+        return process_internal(acquire_node());
+    }
+
+
+    /** @return a copy of the connected node's output, adapted to `num_voices` (see `Voices::adapted_to`) */
     Voices<T> process(std::size_t num_voices) {
         return process().adapted_to(num_voices);
     }
 
 
-    // TODO: This seems incredibly inefficient?
+    /** @return a copy of the connected node's output if it changed since the last check, see `has_changed` */
     std::optional<Voices<T>> process_if_changed() {
-        std::lock_guard lock{m_mutex};
-        return has_changed_internal() ? std::make_optional(process_internal()) : std::nullopt;
+        auto [changed, value] = check_changed(acquire_node());
+        return changed ? std::make_optional(*value) : std::nullopt;
     }
 
 
+    /**
+     * @return true if the connected node's output changed since the previous call to `has_changed` or
+     *         `process_if_changed` (or if neither has been called since the socket was connected). Unaffected by
+     *         other reads of the socket. Within a GenerationGraph cycle, this is an O(1) comparison of output versions
+     */
     bool has_changed() {
-        std::lock_guard lock{m_mutex};
-        return has_changed_internal();
+        return check_changed(acquire_node()).first;
     }
 
     std::size_t voice_count() {
-        std::lock_guard lock{m_mutex};
-        return process_internal().size();
+        return process_internal(acquire_node())->size();
+    }
+
+
+    /**
+     * Caches the connected node's output for as long as the cycle of `source` remains the same (see
+     * `SocketHandler::update_time`), so that `voice_count`, `process`, `read` and `has_changed` within one cycle
+     * share a single evaluation
+     */
+    void bind_time_source(const TimeFrameSource* source) {
+        m_time_source = source;
     }
 
 
+    ConnectionSlot& get_connection_slot() override { return m_slot; }
+
+
     Generative* get_connected() const override {
-        return dynamic_cast<Generative*>(m_node);
+        return get_node();
     }
 
 
     bool is_connectable(Generative& generative) const override {
-        return static_cast<bool>(dynamic_cast<Node<T>*>(&generative));
+        return static_cast<bool>(node_cast<T>(&generative));
     }
 
 
+    /** @return true if the active connection (see `ConnectionSlot`) is set, i.e. as seen while processing */
     bool is_connected() const override {
-        return m_node;
+        return m_slot.active();
     }
 
 
     bool try_connect(Generative& generative) override {
-        std::lock_guard lock{m_mutex};
-        if (auto* node = dynamic_cast<Node<T>*>(&generative)) {
+        if (auto* node = node_cast<T>(&generative)) {
             set_connection_internal(node);
             return true;
         }
@@ -78,7 +113,6 @@ public:
 
 
     void disconnect_if(Generative& connected_to) override {
-        std::lock_guard lock{m_mutex};
         if (get_connected() == &connected_to) {
             set_connection_internal(nullptr);
         }
@@ -86,52 +120,112 @@ public:
 
 
     void connect(Node<T>& node) {
-        std::lock_guard lock{m_mutex};
         set_connection_internal(&node);
     }
 
 
     void disconnect() {
-        std::lock_guard lock{m_mutex};
         set_connection_internal(nullptr);
     }
 
 
 protected:
-    Voices<T> process_internal() {
-        if (m_node == nullptr)
-            return Voices<T>::empty_like();
-        return m_node->process();
+    SharedVoices<T> process_internal(Node<T>* node) {
+        if (node == nullptr)
+            return empty();
+
+        auto cycle = m_time_source ? m_time_source->frame().cycle : 0;
+        if (cycle != 0 && m_cached_value && m_cached_cycle == cycle)
+            return m_cached_value;
+
+        // Within a GenerationGraph cycle, the connected node has already been evaluated by the schedule, since the
+        // graph only applies connections together with a schedule accounting for them. The node is only pulled
+        // outside a graph, or if it's part of a cycle, in which case it's evaluated sequentially
+        auto output = node->shared_output();
+        if (!output)
+            output = make_shared_voices(node->process());
+
+        if (cycle != 0) {
+            m_cached_value = output;
+            m_cached_cycle = cycle;
+        }
+
+        return output;
     }
 
 
-    bool has_changed_internal() {
-        // Note: calling Node.process() multiple times in the same time step won't change the node's value
-        return !m_previous_value.has_value() || m_previous_value != process_internal();
-    }
+    /** @return whether the output changed since it was last checked, along with the current output */
+    std::pair<bool, SharedVoices<T>> check_changed(Node<T>* node) {
+        auto current = process_internal(node);
 
+        // the output version is only maintained when the node is evaluated by a GenerationGraph
+        std::optional<std::size_t> version = std::nullopt;
+        if (node && node->output())
+            version = node->get_output_version();
 
-    virtual void set_connection_internal(Node<T>* node) {
-        if (node) {
-            m_node = node;
+        bool changed;
+        if (!m_checked_value) {
+            changed = true;
+        } else if (version && m_checked_version) {
+            changed = *version != *m_checked_version;
         } else {
-            m_node = nullptr;
+            changed = current != m_checked_value && *current != *m_checked_value;
         }
-        m_previous_value = std::nullopt;
+
+        m_checked_value = current;
+        m_checked_version = version;
+        return {changed, std::move(current)};
+    }
+
+
+    virtual void set_connection_internal(Node<T>* node) {
+        set_node(node);
     }
 
 
-    Node<T>* get_node() const { return m_node; }
+    /** @return the latest connection, which may not yet have been applied (see `ConnectionSlot`) */
+    Node<T>* get_node() const { return static_cast<Node<T>*>(m_slot.target()); }
 
 
-    void set_node(Node<T>* node) { m_node = node; }
+    void set_node(Node<T>* node) {
+        m_slot.connect(node);
+    }
 
 
 private:
-    std::mutex m_mutex;
-    Node<T>* m_node = nullptr;
+    static const SharedVoices<T>& empty() {
+        static const SharedVoices<T> empty_voices = std::make_shared<const Voices<T>>(Voices<T>::empty_like());
+        return empty_voices;
+    }
+
+
+    /**
+     * Loads the active connection on the processing thread. The last checked value belongs to the processing thread,
+     * and is therefore invalidated here rather than by the thread changing the connection
+     */
+    Node<T>* acquire_node() {
+        auto* node = static_cast<Node<T>*>(m_slot.active());
+        if (node != m_previous_node) {
+            m_previous_node = node;
+            m_checked_value = nullptr;
+            m_checked_version = std::nullopt;
+            m_cached_value = nullptr;
+        }
+        return node;
+    }
+
+
+    // only ever holds nodes of type `Node<T>`
+    ConnectionSlot m_slot;
+
+    // Only accessed by the processing thread
+    Node<T>* m_previous_node = nullptr;
+    SharedVoices<T> m_checked_value = nullptr;
+    std::optional<std::size_t> m_checked_version = std::nullopt;
 
-    std::optional<Voices<T>> m_previous_value = std::nullopt;
+    const TimeFrameSource* m_time_source = nullptr;
+    SharedVoices<T> m_cached_value = nullptr;
+    std::size_t m_cached_cycle = 0;
 };
 
 
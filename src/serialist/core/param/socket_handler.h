@@ -5,6 +5,7 @@
 #include <memory>
 #include "core/connectable.h"
 #include "core/param/parameter_keys.h"
+#include "core/temporal/time_gate.h"
 
 namespace serialist {
 
@@ -16,15 +17,38 @@ public:
 
     template<typename T>
     Socket<T>& create_socket(const std::string& id, Node<T>* initial = nullptr) {
-        m_sockets.emplace_back(std::make_unique<Socket<T>>(id, m_socket_parameter_handler, initial));
-        return dynamic_cast<Socket<T>&>(*m_sockets.back());
+        auto socket = std::make_unique<Socket<T>>(id, m_socket_parameter_handler, initial);
+        socket->bind_time_source(m_time_source.get());
+
+        auto& ref = *socket;
+        m_sockets.emplace_back(id, std::move(socket));
+        return ref;
+    }
+
+
+    /**
+     * Starts a new processing cycle of the owning generative at time `t`. Sockets evaluate their connected node at
+     * most once per cycle, so this should be called once per time step, before the owner is processed, unless the
+     * owner follows a shared frame (see `bind_time_frame`). Caching is disabled until the first cycle.
+     */
+    void update_time(const TimePoint& t) {
+        m_time_source->update_time(t);
+    }
+
+
+    /** Follows `frame`, advanced by its owner, rather than `update_time`, or `update_time` again if nullptr */
+    void bind_time_frame(const TimeFrame* frame) {
+        m_time_source->bind(frame);
     }
 
 
+    const TimeFrameSource& time_source() const { return *m_time_source; }
+
+
     std::vector<Generative*> get_connected() const {
         std::vector<Generative*> generatives;
 
-        for (auto& socket: m_sockets) {
+        for (auto& [id, socket]: m_sockets) {
             if (auto* generative = socket->get_connected()) {
                 generatives.push_back(generative);
             }
@@ -33,8 +57,42 @@ public:
     }
 
 
+    /** @return id and connected generative of every connected socket */
+    std::vector<std::pair<std::string, Generative*>> get_connections() const {
+        std::vector<std::pair<std::string, Generative*>> connections;
+
+        for (auto& [id, socket]: m_sockets) {
+            if (auto* generative = socket->get_connected()) {
+                connections.emplace_back(id, generative);
+            }
+        }
+        return connections;
+    }
+
+
+    std::vector<ConnectionSlot*> get_connection_slots() const {
+        std::vector<ConnectionSlot*> slots;
+        slots.reserve(m_sockets.size());
+
+        for (auto& [id, socket]: m_sockets) {
+            slots.push_back(&socket->get_connection_slot());
+        }
+        return slots;
+    }
+
+
+    /** @return false if there's no socket `id` or if it doesn't accept the output type of `generative` */
+    bool try_connect(const std::string& id, Generative& generative) {
+        for (auto& [socket_id, socket]: m_sockets) {
+            if (socket_id == id)
+                return socket->try_connect(generative);
+        }
+        return false;
+    }
+
+
     void disconnect_if(Generative& connected_to) {
-        for (const auto& socket: m_sockets) {
+        for (const auto& [id, socket]: m_sockets) {
             socket->disconnect_if(connected_to);
         }
     }
@@ -48,7 +106,10 @@ public:
 private:
     ParameterHandler m_socket_parameter_handler;
 
-    std::vector<std::unique_ptr<Connectable>> m_sockets;
+    std::vector<std::pair<std::string, std::unique_ptr<Connectable>>> m_sockets;
+
+    // heap allocated, as sockets keep a pointer to it
+    std::unique_ptr<TimeFrameSource> m_time_source = std::make_unique<TimeFrameSource>();
 };
 
 } // namespace serialist
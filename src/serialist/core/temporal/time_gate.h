@@ -2,6 +2,7 @@
 #ifndef SERIALISTLOOPER_TIME_GATE_H
 #define SERIALISTLOOPER_TIME_GATE_H
 
+#include <atomic>
 #include <optional>
 #include "core/temporal/transport.h"
 #include "core/types/time_point.h"
@@ -9,28 +10,85 @@
 namespace serialist {
 
 /**
- * Detects updates in time. Typically used to detect whether process() already has been called this particular cycle
+ * Time of a single processing cycle, identified by an id that is unique across all TimeFrames. This lets a generative
+ * detect a new cycle by comparing a single integer, regardless of which frame it currently is following.
  */
-class TimeGate {
+struct TimeFrame {
+    TimePoint time;
+    std::size_t cycle = 0; // 0 until the first call to `advance`
+
+    void advance(const TimePoint& t) {
+        time = t;
+        cycle = s_next_cycle.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+private:
+    static inline std::atomic<std::size_t> s_next_cycle{0};
+};
+
+
+// ==============================================================================================
+
+/**
+ * The TimeFrame followed by a single generative: either its own frame, advanced by `update_time`, or a frame shared
+ * with other generatives (see `GenerationGraph`), which is advanced once per cycle by its owner.
+ */
+class TimeFrameSource {
 public:
-    void push_time(const TimePoint& t) {
-        m_time = t;
+    TimeFrameSource() = default;
+    ~TimeFrameSource() = default;
+    TimeFrameSource(const TimeFrameSource&) = delete;
+    TimeFrameSource& operator=(const TimeFrameSource&) = delete;
+    TimeFrameSource(TimeFrameSource&&) noexcept = delete;
+    TimeFrameSource& operator=(TimeFrameSource&&) noexcept = delete;
+
+
+    /** Advances the local frame to `t` and follows it from here on */
+    void update_time(const TimePoint& t) {
+        m_local.advance(t);
+        m_current.store(&m_local, std::memory_order_release);
     }
 
 
-    std::optional<TimePoint> pop_time() {
-        if (m_time) {
-            auto ret = m_time;
-            m_time = std::nullopt;
-            return ret;
-        } else {
-            return std::nullopt;
-        }
+    /** Follows `shared` rather than the local frame, or the local frame again if nullptr */
+    void bind(const TimeFrame* shared) {
+        m_current.store(shared ? shared : &m_local, std::memory_order_release);
     }
 
 
+    const TimeFrame& frame() const { return *m_current.load(std::memory_order_acquire); }
+
 private:
-    std::optional<TimePoint> m_time = std::nullopt;
+    TimeFrame m_local;
+    std::atomic<const TimeFrame*> m_current{&m_local};
+};
+
+
+// ==============================================================================================
+
+/**
+ * Detects new cycles of a TimeFrameSource. Typically used to detect whether process() already has been called this
+ * particular cycle
+ */
+class TimeGate {
+public:
+    explicit TimeGate(const TimeFrameSource& source) : m_source(source) {}
+
+
+    /** @return the time of the current cycle the first time it's called in each cycle, otherwise nullptr */
+    const TimePoint* pop_time() {
+        const auto& frame = m_source.frame();
+        if (frame.cycle == 0 || frame.cycle == m_last_cycle)
+            return nullptr;
+
+        m_last_cycle = frame.cycle;
+        return &frame.time;
+    }
+
+
+private:
+    const TimeFrameSource& m_source;
+    std::size_t m_last_cycle = 0;
 };
 
 
@@ -4,6 +4,7 @@
 
 #include <variant>
 #include "core/algo/pitch/notes.h"
+#include "core/utility/math.h"
 
 namespace serialist {
 
@@ -48,6 +49,21 @@ public:
         return std::get<T>(m_event);
     }
 
+
+    /**
+     * @return a copy of this event occurring at `step_offset` in [0.0, 1.0] of the latest time step, typically the
+     *         step offset of the trigger that produced it (see `Trigger::with_step_offset`)
+     */
+    Event with_step_offset(double step_offset) const {
+        Event e{*this};
+        e.m_step_offset = utils::clip(step_offset, 0.0, 1.0);
+        return e;
+    }
+
+
+    double get_step_offset() const { return m_step_offset; }
+
+
     explicit operator std::string() const {
         if (is<MidiNoteEvent>()) return static_cast<std::string>(as<MidiNoteEvent>());
         throw std::runtime_error("Unknown event type");
@@ -68,6 +84,9 @@ public:
 private:
     EventType m_event;
 
+    // position within the time step in which the event occurred, see `with_step_offset`
+    double m_step_offset = 1.0;
+
 };
 
 //using Event = std::variant<MidiNoteEvent>;
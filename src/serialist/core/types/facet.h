@@ -8,6 +8,7 @@
 #include <magic_enum/magic_enum.hpp>
 
 #include "utility/math.h"
+#include "utility/traits.h"
 
 namespace serialist {
 
@@ -319,5 +320,14 @@ template<>
 struct std::is_arithmetic<serialist::Facet> : std::true_type {
 };
 
+template<>
+struct serialist::utils::is_double_like<serialist::Facet> : std::true_type {
+};
+
+static_assert(std::is_standard_layout_v<serialist::Facet>
+              && std::is_trivially_copyable_v<serialist::Facet>
+              && sizeof(serialist::Facet) == sizeof(double)
+              && alignof(serialist::Facet) == alignof(double));
+
 
 #endif //SERIALISTLOOPER_FACET_H
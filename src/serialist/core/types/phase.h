@@ -212,6 +212,27 @@ public:
     }
 
 
+    /**
+     * Fraction of the transition from start to end (optionally: in `interval_direction`) at which `position` is
+     * reached, assuming a constant rate of change between the two. Returns 1.0 if start == end.
+     */
+    static double crossing_fraction(const Phase& start
+                                    , const Phase& end
+                                    , const Phase& position
+                                    , std::optional<Direction> interval_direction = std::nullopt) {
+        if (!interval_direction) {
+            interval_direction = direction(start, end);
+        }
+
+        auto total = distance(start, end, interval_direction);
+        if (total <= 0.0) {
+            return 1.0;
+        }
+
+        return utils::clip(distance(start, position, interval_direction) / total, 0.0, 1.0);
+    }
+
+
     double distance_to(const Phase& end, std::optional<Direction> interval_direction = std::nullopt) const {
         return distance(*this, end, interval_direction);
     }
@@ -188,6 +188,15 @@ public:
         return os;
     }
 
+    /**
+     * @return a copy of this trigger occurring at `step_offset` in [0.0, 1.0] of the latest time step, where 0.0 is
+     *         the previous time point and 1.0 is the current one. Not part of the trigger's identity (operator==)
+     */
+    Trigger with_step_offset(double step_offset) const {
+        return {m_type, m_id, utils::clip(step_offset, 0.0, 1.0)};
+    }
+
+
     bool terminates(const Trigger& start) const {
         return start.m_type == Type::pulse_on && m_type == Type::pulse_off && start.m_id == m_id;
     }
@@ -200,13 +209,19 @@ public:
 
     std::size_t get_id() const { return m_id; }
 
+    double get_step_offset() const { return m_step_offset; }
+
 
 private:
-    Trigger(const Type& type, std::size_t id) : m_type(type), m_id(id) {}
+    Trigger(const Type& type, std::size_t id, double step_offset = 1.0)
+        : m_type(type), m_id(id), m_step_offset(step_offset) {}
 
     Type m_type;
     std::size_t m_id;
 
+    // position within the time step in which the trigger occurred, see `with_step_offset`
+    double m_step_offset;
+
 };
 
 
@@ -0,0 +1,247 @@
+
+#ifndef SERIALIST_CYCLE_ARENA_H
+#define SERIALIST_CYCLE_ARENA_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace serialist {
+
+/**
+ * @brief Memory resource used by containers allocating on the calling thread (see `SmallVector`).
+ *
+ * Defaults to `std::pmr::new_delete_resource()`, and is replaced for the lifetime of a `Scope`. Note that only
+ * allocations use the thread's resource: each container returns its memory to the resource it was allocated from.
+ */
+class ThreadMemoryResource {
+public:
+    ThreadMemoryResource() = delete;
+
+
+    static std::pmr::memory_resource* get() noexcept { return current(); }
+
+
+    /** Installs `resource` on the calling thread until destroyed, restoring the previous one */
+    class Scope {
+    public:
+        explicit Scope(std::pmr::memory_resource& resource) noexcept : m_previous(current()) {
+            current() = &resource;
+        }
+
+
+        ~Scope() { current() = m_previous; }
+
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) noexcept = delete;
+        Scope& operator=(Scope&&) noexcept = delete;
+
+    private:
+        std::pmr::memory_resource* m_previous;
+    };
+
+private:
+    static std::pmr::memory_resource*& current() noexcept {
+        static thread_local std::pmr::memory_resource* resource = std::pmr::new_delete_resource();
+        return resource;
+    }
+};
+
+
+// ==============================================================================================
+
+/**
+ * @brief Pooled memory resource for the short-lived buffers allocated while processing a cycle.
+ *
+ * Blocks are served from per-size-class free lists carved out of large chunks, so that once every size class
+ * has been warmed up, allocating and freeing doesn't involve the global allocator at all. Chunks are only
+ * returned upstream when the arena is destroyed.
+ *
+ * Only the thread that currently has the arena installed (see `ThreadMemoryResource::Scope`) may allocate from it.
+ * Blocks may however be freed from any thread, as buffers allocated during a cycle (e.g. a node's output) often
+ * outlive it: blocks freed by other threads are pushed to a lock-free list, and recycled on `reclaim_remote`.
+ *
+ * The arena is destroyed once its owning `Handle` and all blocks allocated from it (including those too large to be
+ * pooled, which are passed on to the global allocator) have been released.
+ */
+class CycleArena : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t MIN_BLOCK_SIZE = 16;
+    static constexpr std::size_t MAX_BLOCK_SIZE = std::size_t{1} << 16;
+    static constexpr std::size_t CHUNK_SIZE = std::size_t{1} << 18;
+
+    struct Release {
+        void operator()(CycleArena* arena) const { arena->release_reference(); }
+    };
+
+    using Handle = std::unique_ptr<CycleArena, Release>;
+
+
+    static Handle create() {
+        return Handle(new CycleArena());
+    }
+
+
+    CycleArena(const CycleArena&) = delete;
+    CycleArena& operator=(const CycleArena&) = delete;
+    CycleArena(CycleArena&&) noexcept = delete;
+    CycleArena& operator=(CycleArena&&) noexcept = delete;
+
+
+    /** Recycles all blocks freed by other threads. Must only be called by the thread that has the arena installed */
+    void reclaim_remote() noexcept {
+        auto* block = m_remote_blocks.exchange(nullptr, std::memory_order_acquire);
+        while (block) {
+            auto* next = block->next;
+            push_free(block, block->size_class);
+            block = next;
+        }
+    }
+
+
+    /** @return number of chunks allocated from the upstream resource since construction */
+    std::size_t num_chunks() const noexcept { return m_chunks.size(); }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (!is_pooled(bytes, alignment)) {
+            // the arena still has to outlive the block, as it's returned through `do_deallocate`
+            auto* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            m_references.fetch_add(1, std::memory_order_relaxed);
+            return p;
+        }
+
+        auto size_class = size_class_of(bytes);
+        auto* block = m_free_blocks[size_class];
+        if (block) {
+            m_free_blocks[size_class] = block->next;
+        } else {
+            block = carve(block_size(size_class));
+        }
+
+        m_references.fetch_add(1, std::memory_order_relaxed);
+        return block;
+    }
+
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        if (!is_pooled(bytes, alignment)) {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            release_reference();
+            return;
+        }
+
+        auto size_class = size_class_of(bytes);
+        auto* block = static_cast<Block*>(p);
+
+        if (ThreadMemoryResource::get() == this) {
+            push_free(block, size_class);
+        } else {
+            block->size_class = size_class;
+            block->next = m_remote_blocks.load(std::memory_order_relaxed);
+            while (!m_remote_blocks.compare_exchange_weak(block->next, block
+                                                          , std::memory_order_release
+                                                          , std::memory_order_relaxed)) {}
+        }
+
+        release_reference();
+    }
+
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    /** Header of a free block, stored in the block itself */
+    struct Block {
+        Block* next;
+        std::size_t size_class;
+    };
+
+    static_assert(sizeof(Block) <= MIN_BLOCK_SIZE);
+    static_assert(CHUNK_SIZE >= MAX_BLOCK_SIZE);
+
+    static constexpr std::size_t NUM_SIZE_CLASSES = 13; // MIN_BLOCK_SIZE << 12 == MAX_BLOCK_SIZE
+
+
+    CycleArena() = default;
+
+
+    ~CycleArena() override {
+        for (auto* chunk: m_chunks) {
+            std::pmr::new_delete_resource()->deallocate(chunk, CHUNK_SIZE, alignof(std::max_align_t));
+        }
+    }
+
+
+    static bool is_pooled(std::size_t bytes, std::size_t alignment) noexcept {
+        return bytes <= MAX_BLOCK_SIZE && alignment <= alignof(std::max_align_t);
+    }
+
+
+    static std::size_t size_class_of(std::size_t bytes) noexcept {
+        std::size_t size_class = 0;
+        while (block_size(size_class) < bytes) {
+            ++size_class;
+        }
+        return size_class;
+    }
+
+
+    static constexpr std::size_t block_size(std::size_t size_class) noexcept {
+        return MIN_BLOCK_SIZE << size_class;
+    }
+
+
+    void push_free(Block* block, std::size_t size_class) noexcept {
+        block->next = m_free_blocks[size_class];
+        m_free_blocks[size_class] = block;
+    }
+
+
+    Block* carve(std::size_t size) {
+        if (m_chunk_remaining < size) {
+            // the tail of the current chunk is dropped, as it's smaller than MAX_BLOCK_SIZE
+            m_chunks.reserve(m_chunks.size() + 1);
+            auto* chunk = std::pmr::new_delete_resource()->allocate(CHUNK_SIZE, alignof(std::max_align_t));
+            m_chunks.push_back(chunk);
+            m_chunk_position = static_cast<std::byte*>(chunk);
+            m_chunk_remaining = CHUNK_SIZE;
+        }
+
+        auto* block = reinterpret_cast<Block*>(m_chunk_position);
+        m_chunk_position += size;
+        m_chunk_remaining -= size;
+        return block;
+    }
+
+
+    void release_reference() noexcept {
+        if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+
+    // only accessed by the thread that has the arena installed
+    std::array<Block*, NUM_SIZE_CLASSES> m_free_blocks{};
+    std::vector<void*> m_chunks;
+    std::byte* m_chunk_position = nullptr;
+    std::size_t m_chunk_remaining = 0;
+
+    // blocks freed by other threads
+    alignas(64) std::atomic<Block*> m_remote_blocks{nullptr};
+
+    // the owning `Handle` and every outstanding block
+    std::atomic<std::size_t> m_references{1};
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_CYCLE_ARENA_H
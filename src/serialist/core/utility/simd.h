@@ -0,0 +1,323 @@
+
+#ifndef SERIALIST_SIMD_H
+#define SERIALIST_SIMD_H
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SERIALIST_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Vectorized kernels over contiguous arrays of doubles, used by the arithmetic operations of `Vec<T>` for
+ *        `T` stored as a double (see `utils::is_double_like`).
+ *
+ * The instruction set is chosen at compile time: AVX if enabled (e.g. `-mavx` or `-march=native`), otherwise SSE2
+ * (always available on x86-64), otherwise a scalar fallback. Element-wise kernels give the same results as their
+ * scalar counterparts, while reductions (`sum`, ...) may differ in the last bits as they're summed in a different
+ * order.
+ */
+namespace serialist::simd {
+
+namespace detail {
+
+#if defined(__AVX__)
+
+struct Batch {
+    static constexpr std::size_t SIZE = 4;
+
+    __m256d v;
+
+    static Batch load(const double* p) { return {_mm256_loadu_pd(p)}; }
+
+    static Batch broadcast(double x) { return {_mm256_set1_pd(x)}; }
+
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+
+    friend Batch operator+(Batch a, Batch b) { return {_mm256_add_pd(a.v, b.v)}; }
+
+    friend Batch operator-(Batch a, Batch b) { return {_mm256_sub_pd(a.v, b.v)}; }
+
+    friend Batch operator*(Batch a, Batch b) { return {_mm256_mul_pd(a.v, b.v)}; }
+
+    friend Batch operator/(Batch a, Batch b) { return {_mm256_div_pd(a.v, b.v)}; }
+
+    /** `b < a ? b : a`, i.e. `std::min(a, b)` (including NaN handling) */
+    static Batch min(Batch a, Batch b) { return {_mm256_min_pd(b.v, a.v)}; }
+
+    /** `a < b ? b : a`, i.e. `std::max(a, b)` (including NaN handling) */
+    static Batch max(Batch a, Batch b) { return {_mm256_max_pd(b.v, a.v)}; }
+
+    static Batch abs(Batch a) { return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v)}; }
+
+    double horizontal_sum() const {
+        alignas(32) double lanes[SIZE];
+        _mm256_store_pd(lanes, v);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    void to_array(double* lanes) const { _mm256_storeu_pd(lanes, v); }
+};
+
+#elif defined(SERIALIST_SIMD_SSE2)
+
+struct Batch {
+    static constexpr std::size_t SIZE = 2;
+
+    __m128d v;
+
+    static Batch load(const double* p) { return {_mm_loadu_pd(p)}; }
+
+    static Batch broadcast(double x) { return {_mm_set1_pd(x)}; }
+
+    void store(double* p) const { _mm_storeu_pd(p, v); }
+
+    friend Batch operator+(Batch a, Batch b) { return {_mm_add_pd(a.v, b.v)}; }
+
+    friend Batch operator-(Batch a, Batch b) { return {_mm_sub_pd(a.v, b.v)}; }
+
+    friend Batch operator*(Batch a, Batch b) { return {_mm_mul_pd(a.v, b.v)}; }
+
+    friend Batch operator/(Batch a, Batch b) { return {_mm_div_pd(a.v, b.v)}; }
+
+    /** `b < a ? b : a`, i.e. `std::min(a, b)` (including NaN handling) */
+    static Batch min(Batch a, Batch b) { return {_mm_min_pd(b.v, a.v)}; }
+
+    /** `a < b ? b : a`, i.e. `std::max(a, b)` (including NaN handling) */
+    static Batch max(Batch a, Batch b) { return {_mm_max_pd(b.v, a.v)}; }
+
+    static Batch abs(Batch a) { return {_mm_andnot_pd(_mm_set1_pd(-0.0), a.v)}; }
+
+    double horizontal_sum() const {
+        alignas(16) double lanes[SIZE];
+        _mm_store_pd(lanes, v);
+        return lanes[0] + lanes[1];
+    }
+
+    void to_array(double* lanes) const { _mm_storeu_pd(lanes, v); }
+};
+
+#else
+
+struct Batch {
+    static constexpr std::size_t SIZE = 1;
+
+    double v;
+
+    static Batch load(const double* p) { return {*p}; }
+
+    static Batch broadcast(double x) { return {x}; }
+
+    void store(double* p) const { *p = v; }
+
+    friend Batch operator+(Batch a, Batch b) { return {a.v + b.v}; }
+
+    friend Batch operator-(Batch a, Batch b) { return {a.v - b.v}; }
+
+    friend Batch operator*(Batch a, Batch b) { return {a.v * b.v}; }
+
+    friend Batch operator/(Batch a, Batch b) { return {a.v / b.v}; }
+
+    static Batch min(Batch a, Batch b) { return {b.v < a.v ? b.v : a.v}; }
+
+    static Batch max(Batch a, Batch b) { return {a.v < b.v ? b.v : a.v}; }
+
+    static Batch abs(Batch a) { return {std::abs(a.v)}; }
+
+    double horizontal_sum() const { return v; }
+
+    void to_array(double* lanes) const { *lanes = v; }
+};
+
+#endif
+
+
+/** Scalar equivalent of a Batch, used for the remainder of arrays whose size isn't a multiple of Batch::SIZE */
+struct Scalar {
+    double v;
+
+    static Scalar load(const double* p) { return {*p}; }
+
+    static Scalar broadcast(double x) { return {x}; }
+
+    void store(double* p) const { *p = v; }
+
+    friend Scalar operator+(Scalar a, Scalar b) { return {a.v + b.v}; }
+
+    friend Scalar operator-(Scalar a, Scalar b) { return {a.v - b.v}; }
+
+    friend Scalar operator*(Scalar a, Scalar b) { return {a.v * b.v}; }
+
+    friend Scalar operator/(Scalar a, Scalar b) { return {a.v / b.v}; }
+
+    static Scalar min(Scalar a, Scalar b) { return {b.v < a.v ? b.v : a.v}; }
+
+    static Scalar max(Scalar a, Scalar b) { return {a.v < b.v ? b.v : a.v}; }
+
+    static Scalar abs(Scalar a) { return {std::abs(a.v)}; }
+};
+
+
+/** Applies `f(x)` to every element of `data` in place, where `f` is generic over Batch and Scalar */
+template<typename Function>
+void transform(double* data, std::size_t size, Function&& f) {
+    std::size_t i = 0;
+    for (; i + Batch::SIZE <= size; i += Batch::SIZE) {
+        f(Batch::load(data + i)).store(data + i);
+    }
+    for (; i < size; ++i) {
+        f(Scalar::load(data + i)).store(data + i);
+    }
+}
+
+
+/** Applies `f(x, y)` to every pair of elements of `data` and `other`, storing the result in `data` */
+template<typename Function>
+void transform(double* data, const double* other, std::size_t size, Function&& f) {
+    std::size_t i = 0;
+    for (; i + Batch::SIZE <= size; i += Batch::SIZE) {
+        f(Batch::load(data + i), Batch::load(other + i)).store(data + i);
+    }
+    for (; i < size; ++i) {
+        f(Scalar::load(data + i), Scalar::load(other + i)).store(data + i);
+    }
+}
+
+
+/** Sums `f(x)` over all elements of `data` */
+template<typename Function>
+double sum(const double* data, std::size_t size, Function&& f) {
+    auto batch_sum = Batch::broadcast(0.0);
+    std::size_t i = 0;
+    for (; i + Batch::SIZE <= size; i += Batch::SIZE) {
+        batch_sum = batch_sum + f(Batch::load(data + i));
+    }
+
+    double total = batch_sum.horizontal_sum();
+    for (; i < size; ++i) {
+        total += f(Scalar::load(data + i)).v;
+    }
+    return total;
+}
+
+
+/** Folds `f(accumulated, x)` over all elements of `data`, where `f` is min or max */
+template<typename Function>
+double reduce(const double* data, std::size_t size, double initial, Function&& f) {
+    std::size_t i = 0;
+    double result = initial;
+
+    if (size >= Batch::SIZE) {
+        auto batch_result = Batch::load(data);
+        for (i = Batch::SIZE; i + Batch::SIZE <= size; i += Batch::SIZE) {
+            batch_result = f(batch_result, Batch::load(data + i));
+        }
+
+        double lanes[Batch::SIZE];
+        batch_result.to_array(lanes);
+        for (auto lane: lanes) {
+            result = f(Scalar{result}, Scalar{lane}).v;
+        }
+    }
+
+    for (; i < size; ++i) {
+        result = f(Scalar{result}, Scalar::load(data + i)).v;
+    }
+    return result;
+}
+
+} // namespace detail
+
+
+// =========================== ELEMENT-WISE ==========================
+
+inline void add(double* data, std::size_t size, double value) {
+    detail::transform(data, size, [value](auto x) { return x + decltype(x)::broadcast(value); });
+}
+
+
+inline void add(double* data, const double* other, std::size_t size) {
+    detail::transform(data, other, size, [](auto x, auto y) { return x + y; });
+}
+
+
+inline void subtract(double* data, std::size_t size, double value) {
+    detail::transform(data, size, [value](auto x) { return x - decltype(x)::broadcast(value); });
+}
+
+
+inline void subtract(double* data, const double* other, std::size_t size) {
+    detail::transform(data, other, size, [](auto x, auto y) { return x - y; });
+}
+
+
+inline void multiply(double* data, std::size_t size, double value) {
+    detail::transform(data, size, [value](auto x) { return x * decltype(x)::broadcast(value); });
+}
+
+
+inline void multiply(double* data, const double* other, std::size_t size) {
+    detail::transform(data, other, size, [](auto x, auto y) { return x * y; });
+}
+
+
+inline void divide(double* data, std::size_t size, double value) {
+    detail::transform(data, size, [value](auto x) { return x / decltype(x)::broadcast(value); });
+}
+
+
+inline void divide(double* data, const double* other, std::size_t size) {
+    detail::transform(data, other, size, [](auto x, auto y) { return x / y; });
+}
+
+
+/** `x = std::min(x, value)` for every element */
+inline void min_of(double* data, std::size_t size, double value) {
+    detail::transform(data, size, [value](auto x) { return decltype(x)::min(x, decltype(x)::broadcast(value)); });
+}
+
+
+/** `x = std::max(x, value)` for every element */
+inline void max_of(double* data, std::size_t size, double value) {
+    detail::transform(data, size, [value](auto x) { return decltype(x)::max(x, decltype(x)::broadcast(value)); });
+}
+
+
+// =========================== REDUCTIONS ==========================
+
+inline double sum(const double* data, std::size_t size) {
+    return detail::sum(data, size, [](auto x) { return x; });
+}
+
+
+inline double sum_abs(const double* data, std::size_t size) {
+    return detail::sum(data, size, [](auto x) { return decltype(x)::abs(x); });
+}
+
+
+inline double sum_squares(const double* data, std::size_t size) {
+    return detail::sum(data, size, [](auto x) { return x * x; });
+}
+
+
+/** @return the smallest element, or +infinity if `size == 0` */
+inline double min(const double* data, std::size_t size) {
+    return detail::reduce(data, size, std::numeric_limits<double>::infinity()
+                          , [](auto a, auto b) { return decltype(a)::min(a, b); });
+}
+
+
+/** @return the largest element, or -infinity if `size == 0` */
+inline double max(const double* data, std::size_t size) {
+    return detail::reduce(data, size, -std::numeric_limits<double>::infinity()
+                          , [](auto a, auto b) { return decltype(a)::max(a, b); });
+}
+
+} // namespace serialist::simd
+
+#endif //SERIALIST_SIMD_H
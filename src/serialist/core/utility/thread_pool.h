@@ -0,0 +1,347 @@
+#ifndef SERIALIST_THREAD_POOL_H
+#define SERIALIST_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace serialist {
+
+/**
+ * @brief Fixed-size pool of worker threads executing blocking `parallel_for` jobs with work stealing.
+ *
+ * The calling thread always participates in the job, so a pool with `num_threads` threads spawns
+ * `num_threads - 1` workers. Each job is split into one contiguous range of tasks per thread. Every thread consumes
+ * its own range from the front, and once it's exhausted, steals the back half of the largest remaining range.
+ *
+ * `parallel_for` doesn't allocate nor lock: the job is written to a slot preallocated by the pool, and the caller
+ * joins by spinning on an atomic counter. Idle workers spin for a short while before going to sleep, in which case
+ * the next job has to wake them through a condition variable. Jobs submitted at a steady rate (e.g. once per
+ * processing cycle) therefore find the workers awake.
+ */
+class ThreadPool {
+public:
+    static constexpr std::size_t MAX_NUM_TASKS = UINT32_MAX;
+
+    explicit ThreadPool(std::size_t num_threads)
+            : m_ranges(std::make_unique<Range[]>(std::max(num_threads, std::size_t{1})))
+            , m_num_threads(std::max(num_threads, std::size_t{1})) {
+        for (std::size_t i = 1; i < m_num_threads; ++i) {
+            m_workers.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+
+    ~ThreadPool() {
+        m_stop.store(true, std::memory_order_seq_cst);
+        wake_sleeping_workers();
+
+        for (auto& worker: m_workers) {
+            worker.join();
+        }
+    }
+
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) noexcept = delete;
+    ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+
+    /**
+     * Calls `f(i)` for every i in [0, num_tasks) and blocks until all calls have returned. `f` may alternatively
+     * take a second argument `f(i, thread)`, where `thread` in [0, num_threads) identifies the executing thread,
+     * 0 being the calling thread. Must not be called concurrently from multiple threads.
+     *
+     * @throw the first exception thrown by any call to `f`, once all tasks have finished
+     */
+    template<typename F>
+    void parallel_for(std::size_t num_tasks, F&& f) {
+        assert(num_tasks <= MAX_NUM_TASKS);
+
+        if (num_tasks == 0)
+            return;
+
+        if (m_workers.empty() || num_tasks == 1) {
+            for (std::size_t i = 0; i < num_tasks; ++i) {
+                invoke(f, i, 0);
+            }
+            return;
+        }
+
+        // the job slot is only written while no worker is inside a job (see `close_job`)
+        m_context = static_cast<const void*>(std::addressof(f));
+        m_invoke = &invoke_erased<std::remove_reference_t<F>>;
+        m_exception = nullptr;
+        m_has_exception.store(false, std::memory_order_relaxed);
+        m_remaining.store(num_tasks, std::memory_order_relaxed);
+
+        for (std::size_t thread = 0; thread < m_num_threads; ++thread) {
+            auto begin = num_tasks * thread / m_num_threads;
+            auto end = num_tasks * (thread + 1) / m_num_threads;
+            m_ranges[thread].bounds.store(Range::pack(begin, end), std::memory_order_relaxed);
+        }
+
+        open_job();
+
+        run(0);
+
+        for (Backoff backoff; m_remaining.load(std::memory_order_acquire) != 0;) {
+            backoff.wait();
+        }
+
+        close_job();
+
+        if (m_has_exception.load(std::memory_order_acquire))
+            std::rethrow_exception(m_exception);
+    }
+
+
+    std::size_t num_threads() const { return m_num_threads; }
+
+
+private:
+    static constexpr std::size_t SPIN_ITERATIONS = 64;
+    static constexpr std::size_t YIELD_ITERATIONS = 4096;
+
+
+    /** Tasks [begin, end) not yet claimed by any thread, packed into a single word so that it can be CASed */
+    struct alignas(64) Range {
+        std::atomic<std::uint64_t> bounds{0};
+
+        static std::uint64_t pack(std::size_t begin, std::size_t end) {
+            return (static_cast<std::uint64_t>(begin) << 32) | static_cast<std::uint64_t>(end);
+        }
+
+        static std::size_t begin(std::uint64_t bounds) { return static_cast<std::size_t>(bounds >> 32); }
+
+        static std::size_t end(std::uint64_t bounds) { return static_cast<std::size_t>(bounds & UINT32_MAX); }
+    };
+
+
+    /** Spins, then yields, for callers that wait for a short time without blocking */
+    class Backoff {
+    public:
+        void wait() {
+            if (m_iteration < SPIN_ITERATIONS) {
+                pause();
+            } else {
+                std::this_thread::yield();
+            }
+            ++m_iteration;
+        }
+
+        bool exhausted() const { return m_iteration >= SPIN_ITERATIONS + YIELD_ITERATIONS; }
+
+    private:
+        static void pause() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+            _mm_pause();
+#endif
+        }
+
+        std::size_t m_iteration = 0;
+    };
+
+
+    template<typename F>
+    static void invoke(F& f, std::size_t task, std::size_t thread) {
+        if constexpr (std::is_invocable_v<F&, std::size_t, std::size_t>) {
+            f(task, thread);
+        } else {
+            f(task);
+        }
+    }
+
+
+    template<typename F>
+    static void invoke_erased(const void* context, std::size_t task, std::size_t thread) {
+        invoke(*static_cast<F*>(const_cast<void*>(context)), task, thread);
+    }
+
+
+    /**
+     * The state word holds the generation of the latest job, shifted by one, with the lowest bit set while the job
+     * is open. A worker may only touch the job slot between entering (incrementing `m_num_active`) a job it observed
+     * as open, and leaving it again.
+     */
+    void open_job() {
+        auto generation = (m_state.load(std::memory_order_relaxed) >> 1) + 1;
+        m_state.store((generation << 1) | 1, std::memory_order_seq_cst);
+
+        if (m_num_sleeping.load(std::memory_order_seq_cst) > 0)
+            wake_sleeping_workers();
+    }
+
+
+    void close_job() {
+        m_state.store(m_state.load(std::memory_order_relaxed) & ~std::size_t{1}, std::memory_order_seq_cst);
+
+        // workers still inside the job have no tasks left, but may still be scanning the ranges
+        for (Backoff backoff; m_num_active.load(std::memory_order_seq_cst) != 0;) {
+            backoff.wait();
+        }
+    }
+
+
+    void wake_sleeping_workers() {
+        { std::lock_guard lock{m_sleep_mutex}; }
+        m_wake.notify_all();
+    }
+
+
+    void worker_loop(std::size_t thread) {
+        std::size_t last_generation = 0;
+
+        while (true) {
+            auto state = wait_for_job(last_generation);
+            if (m_stop.load(std::memory_order_acquire))
+                return;
+
+            last_generation = state >> 1;
+
+            m_num_active.fetch_add(1, std::memory_order_seq_cst);
+            if (m_state.load(std::memory_order_seq_cst) == state)
+                run(thread);
+            m_num_active.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+
+
+    /** @return the state of the first open job newer than `last_generation`, or any state if the pool is stopped */
+    std::size_t wait_for_job(std::size_t last_generation) {
+        auto is_new_job = [this, last_generation](std::size_t state) {
+            return (state & 1) && (state >> 1) != last_generation;
+        };
+
+        for (Backoff backoff; !backoff.exhausted(); backoff.wait()) {
+            auto state = m_state.load(std::memory_order_acquire);
+            if (is_new_job(state) || m_stop.load(std::memory_order_acquire))
+                return state;
+        }
+
+        std::unique_lock lock{m_sleep_mutex};
+        m_num_sleeping.fetch_add(1, std::memory_order_seq_cst);
+        std::size_t state;
+        m_wake.wait(lock, [this, &state, &is_new_job] {
+            state = m_state.load(std::memory_order_seq_cst);
+            return is_new_job(state) || m_stop.load(std::memory_order_seq_cst);
+        });
+        m_num_sleeping.fetch_sub(1, std::memory_order_relaxed);
+        return state;
+    }
+
+
+    void run(std::size_t thread) {
+        std::size_t num_completed = 0;
+
+        while (true) {
+            auto task = pop(thread);
+            if (!task) {
+                if (steal(thread))
+                    continue;
+                break;
+            }
+
+            try {
+                m_invoke(m_context, *task, thread);
+            } catch (...) {
+                if (!m_has_exception.exchange(true, std::memory_order_acq_rel))
+                    m_exception = std::current_exception();
+            }
+            ++num_completed;
+        }
+
+        if (num_completed > 0)
+            m_remaining.fetch_sub(num_completed, std::memory_order_acq_rel);
+    }
+
+
+    std::optional<std::size_t> pop(std::size_t thread) {
+        auto& range = m_ranges[thread].bounds;
+        auto bounds = range.load(std::memory_order_acquire);
+
+        while (Range::begin(bounds) < Range::end(bounds)) {
+            auto begin = Range::begin(bounds);
+            if (range.compare_exchange_weak(bounds, Range::pack(begin + 1, Range::end(bounds))
+                                            , std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return begin;
+            }
+        }
+        return std::nullopt;
+    }
+
+
+    /** Moves the back half of the largest other range into the (empty) range of `thread`. @return false if none */
+    bool steal(std::size_t thread) {
+        while (true) {
+            std::size_t victim = thread;
+            std::uint64_t victim_bounds = 0;
+            std::size_t largest = 0;
+
+            for (std::size_t i = 0; i < m_num_threads; ++i) {
+                if (i == thread)
+                    continue;
+
+                auto bounds = m_ranges[i].bounds.load(std::memory_order_acquire);
+                auto size = Range::end(bounds) - std::min(Range::begin(bounds), Range::end(bounds));
+                if (size > largest) {
+                    largest = size;
+                    victim = i;
+                    victim_bounds = bounds;
+                }
+            }
+
+            if (largest == 0)
+                return false;
+
+            auto begin = Range::begin(victim_bounds);
+            auto end = Range::end(victim_bounds);
+            auto middle = begin + largest / 2;
+
+            if (m_ranges[victim].bounds.compare_exchange_strong(victim_bounds, Range::pack(begin, middle)
+                                                                , std::memory_order_acq_rel)) {
+                // only the owner refills its own range, and only once it's empty, hence no other thread writes it
+                m_ranges[thread].bounds.store(Range::pack(middle, end), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+
+    std::vector<std::thread> m_workers;
+
+    // job slot, see `parallel_for`
+    std::unique_ptr<Range[]> m_ranges;
+    const std::size_t m_num_threads;
+    const void* m_context = nullptr;
+    void (* m_invoke)(const void*, std::size_t, std::size_t) = nullptr;
+    std::exception_ptr m_exception = nullptr;
+    std::atomic<bool> m_has_exception{false};
+
+    alignas(64) std::atomic<std::size_t> m_remaining{0};
+    alignas(64) std::atomic<std::size_t> m_state{0};
+    alignas(64) std::atomic<std::size_t> m_num_active{0};
+
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_wake;
+    std::atomic<std::size_t> m_num_sleeping{0};
+    std::atomic<bool> m_stop{false};
+};
+
+} // namespace serialist
+
+#endif //SERIALIST_THREAD_POOL_H
@@ -160,6 +160,21 @@ inline constexpr bool is_sortable_v = is_less_than_comparable<T>::value;
 
 
 
+template<typename T, typename = void>
+struct has_step_offset : std::false_type {};
+
+/** Types positioned within the time step in which they occurred, e.g. `Trigger` and `Event` */
+template<typename T>
+struct has_step_offset<T, std::void_t<decltype(std::declval<const T&>().get_step_offset())>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool has_step_offset_v = has_step_offset<T>::value;
+
+
+// ==============================================================================================
+
+
+
 /**
  * Workaround to handle std::atomic<T>::is_always_lock_free for non-trivially copyable types
  */
@@ -175,6 +190,20 @@ template<typename T>
 inline constexpr bool is_always_lock_free_v = is_always_lock_free<T>::value;
 
 
+// ==============================================================================================
+
+/**
+ * Types with the same object representation as a double (e.g. `Facet`), whose contiguous arrays may be processed as
+ * arrays of doubles (see `simd.h`). Specializations must be standard layout, trivially copyable and of the same size
+ * and alignment as a double.
+ */
+template<typename T>
+struct is_double_like : std::is_same<T, double> {};
+
+template<typename T>
+inline constexpr bool is_double_like_v = is_double_like<T>::value;
+
+
 // ==============================================================================================
 
 template <typename T, typename U, typename = void>
@@ -26,6 +26,33 @@ public:
 
 };
 
+
+// ==============================================================================================
+
+/**
+ * @brief Component editing a GenerationGraph, e.g. the layer containing all modules.
+ *
+ * Sockets of generatives in the graph are connected directly by their widgets, which only takes effect once the
+ * graph's schedule has been updated. Widgets therefore notify the closest parent implementing this interface.
+ */
+class GraphEditor {
+public:
+    GraphEditor() = default;
+
+    virtual ~GraphEditor() = default;
+
+    GraphEditor(const GraphEditor&) = delete;
+
+    GraphEditor& operator=(const GraphEditor&) = delete;
+
+    GraphEditor(GraphEditor&&) noexcept = default;
+
+    GraphEditor& operator=(GraphEditor&&) noexcept = default;
+
+    virtual void update_schedule() = 0;
+
+};
+
 } // namespace serialist
 
 
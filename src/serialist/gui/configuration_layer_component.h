@@ -6,6 +6,7 @@
 #include <juce_gui_extra/juce_gui_extra.h>
 #include "core/param/parameter_policy.h"
 #include "state/generative_component.h"
+#include "bases/connectable_module.h"
 #include "bases/connector_component.h"
 #include "core/generatives/note_source_LEGACY.h"
 #include "core/generation_graph.h"
@@ -19,7 +20,8 @@ namespace serialist {
 
 class ConfigurationLayerComponent : public juce::Component
                                     , public GlobalKeyState::Listener
-                                    , public juce::DragAndDropContainer {
+                                    , public juce::DragAndDropContainer
+                                    , public GraphEditor {
 public:
 
     using KeyCodes = ConfigurationLayerKeyboardShortcuts;
@@ -125,6 +127,11 @@ public:
     }
 
 
+    void update_schedule() override {
+        m_modular_generator.update_schedule();
+    }
+
+
     void dragOperationStarted(const juce::DragAndDropTarget::SourceDetails& dragSourceDetails) override {
         if (auto* source = dragSourceDetails.sourceComponent.get()) {
             GlobalActionHandler::register_action(std::make_unique<Action>(static_cast<int>(ActionTypes::connect)
@@ -293,6 +300,9 @@ private:
             auto component = std::move(cng.value().component);
             auto generatives = std::move(cng.value().generatives);
 
+            // connections made while the module is attached are published together with its generatives
+            m_modular_generator.begin_edit();
+
             addAndMakeVisible(*component, 0);
             component->addMouseListener(this, true);
             m_generative_components.push_back(
@@ -301,6 +311,7 @@ private:
             );
 
             m_modular_generator.add(std::move(generatives));
+            m_modular_generator.end_edit();
             std::cout << "Num modules: " << m_generative_components.size() << "\n";
             resized();
 
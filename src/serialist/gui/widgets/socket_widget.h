@@ -117,7 +117,7 @@ public:
 
     bool connect(ConnectableModule& connectable) override {
         if (auto* generative_component = dynamic_cast<GenerativeComponent*>(&connectable)) {
-            return m_socket.try_connect(generative_component->get_generative());
+            return try_connect(generative_component->get_generative());
         }
         return false;
     }
@@ -145,7 +145,18 @@ private:
 
 
     void connect_internal() {
-        m_socket.try_connect(m_default_widget->get_generative());
+        try_connect(m_default_widget->get_generative());
+    }
+
+
+    bool try_connect(Generative& generative) {
+        if (!m_socket.try_connect(generative))
+            return false;
+
+        // the connection is staged until the graph publishes a schedule accounting for it
+        if (auto* editor = findParentComponentOfClass<GraphEditor>())
+            editor->update_schedule();
+        return true;
     }
 
 
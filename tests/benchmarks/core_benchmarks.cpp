@@ -0,0 +1,344 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "serialist/core/policies/policies.h"
+#include "core/generation_graph.h"
+#include "core/generatives/interpolator.h"
+#include "core/generatives/make_note.h"
+#include "core/generatives/phase_node.h"
+#include "core/generatives/phase_pulsator.h"
+#include "core/generatives/random_node.h"
+#include "core/generatives/router.h"
+#include "core/generatives/sequence.h"
+#include "core/generatives/variable.h"
+
+/*
+ * Synthetic GenerationGraph patches, processed tick by tick. Every benchmark prints one JSON object per line:
+ *
+ *   {"name": "chain", "voices": 16, "width": 1, "ticks": 10000, "ns_per_tick": ..., "p99_ns": ...,
+ *    "allocs_per_tick": ...}
+ *
+ * Usage: core_benchmarks [--ticks N] [--warmup N] [--filter SUBSTRING] [--threads N] [--max-allocs-per-tick X]
+ *
+ * Exits with a non-zero status if any benchmark allocates more than `--max-allocs-per-tick` times per tick on
+ * average once warmed up, as steady-state processing is expected not to use the global allocator. The default of
+ * 0.01 leaves room for the worker arenas (see `GenerationGraph::process`), which may still allocate a chunk for a
+ * size class they haven't served yet long after warmup, as tasks are distributed through work stealing.
+ */
+
+
+// ==============================================================================================
+// Allocation counting
+
+namespace {
+std::atomic<std::size_t> g_num_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc requires the size to be a non-zero multiple of the alignment
+    auto aligned_size = std::max(align, (size + align - 1) / align * align);
+    if (auto* p = std::aligned_alloc(align, aligned_size))
+        return p;
+    throw std::bad_alloc();
+}
+
+
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+
+
+// Every deallocation function forwards to the unsized operator delete, which is never inlined: otherwise the compiler
+// would see `free` called on pointers returned by operator new at the call sites (-Wmismatched-new-delete)
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { operator delete(p); }
+void operator delete(void* p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { operator delete(p); }
+
+
+// ==============================================================================================
+
+using namespace serialist;
+
+namespace {
+
+/** Owns the generatives of a patch until they're added to the graph in a single batch */
+class PatchBuilder {
+public:
+    explicit PatchBuilder(ParameterHandler& root) : m_root(root) {}
+
+
+    template<typename GenerativeType, typename... Args>
+    GenerativeType& create(const std::string& id, Args&& ... args) {
+        auto generative = std::make_unique<GenerativeType>(id, m_root, std::forward<Args>(args)...);
+        auto& ref = *generative;
+        m_generatives.emplace_back(std::move(generative));
+        return ref;
+    }
+
+
+    void observe(Generative& generative) { m_observed.push_back(&generative); }
+
+
+    void build(GenerationGraph& graph) {
+        graph.add(std::move(m_generatives));
+        for (auto* generative: m_observed) {
+            graph.observe(*generative);
+        }
+    }
+
+private:
+    ParameterHandler& m_root;
+    std::vector<std::unique_ptr<Generative>> m_generatives;
+    std::vector<Generative*> m_observed;
+};
+
+
+struct Clock {
+    Node<Facet>* phase;
+    Node<Trigger>* pulsator;
+};
+
+
+Clock create_clock(PatchBuilder& patch, const std::string& id, std::size_t num_voices) {
+    auto& trigger = patch.create<Sequence<Trigger>>(id + "::trigger", Trigger::pulse_on());
+    auto& period = patch.create<Sequence<Facet, double>>(id + "::period", 1.0);
+    auto& voices = patch.create<Variable<Facet, std::size_t>>(id + "::num_voices", num_voices);
+
+    auto& phase = patch.create<PhaseNode>(id + "::phase"
+                                          , &trigger, nullptr, &period, nullptr, nullptr, nullptr, nullptr, nullptr
+                                          , nullptr, &voices);
+
+    auto& durations = patch.create<Sequence<Facet, double>>(id + "::durations"
+                                                            , Voices<double>::singular(0.25));
+    auto& pulsator = patch.create<PhasePulsatorNode>(id + "::pulsator"
+                                                     , &durations, nullptr, &phase, nullptr, nullptr, &voices);
+
+    return {&phase, &pulsator};
+}
+
+
+/** RandomNode -> Interpolator -> MakeNoteNode, triggered by `clock` */
+Node<Event>& create_voice(PatchBuilder& patch, const std::string& id, const Clock& clock, std::size_t num_voices) {
+    auto& voices = patch.create<Variable<Facet, std::size_t>>(id + "::num_voices", num_voices);
+
+    auto& random = patch.create<RandomNode>(id + "::random"
+                                            , clock.pulsator, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr
+                                            , nullptr, nullptr, &voices);
+
+    auto& corpus = patch.create<Sequence<Facet, int>>(id + "::corpus"
+                                                      , Voices<int>::transposed({0, 2, 4, 5, 7, 9, 11}));
+    auto& interpolator = patch.create<InterpolatorNode<Facet>>(id + "::interpolator"
+                                                               , clock.pulsator, &random, &corpus, nullptr
+                                                               , nullptr, nullptr, nullptr, &voices);
+
+    auto& velocity = patch.create<Sequence<Facet, uint32_t>>(id + "::velocity", 100u);
+    auto& channel = patch.create<Sequence<Facet, uint32_t>>(id + "::channel", 1u);
+    return patch.create<MakeNoteNode>(id + "::make_note"
+                                      , clock.pulsator, &interpolator, &velocity, &channel, nullptr, nullptr
+                                      , &voices);
+}
+
+
+/** Single clock driving a single voice chain */
+void build_chain(PatchBuilder& patch, std::size_t num_voices, std::size_t) {
+    auto clock = create_clock(patch, "chain", num_voices);
+    patch.observe(create_voice(patch, "chain::voice", clock, num_voices));
+}
+
+
+/** Single clock driving `width` parallel voice chains */
+void build_fan_out(PatchBuilder& patch, std::size_t num_voices, std::size_t width) {
+    auto clock = create_clock(patch, "fan_out", num_voices);
+    for (std::size_t i = 0; i < width; ++i) {
+        patch.observe(create_voice(patch, "fan_out::voice" + std::to_string(i), clock, num_voices));
+    }
+}
+
+
+/** `width` RandomNodes routed in reverse order through a RouterNode with `width` inlets */
+void build_router(PatchBuilder& patch, std::size_t num_voices, std::size_t width) {
+    auto clock = create_clock(patch, "router", num_voices);
+    auto& voices = patch.create<Variable<Facet, std::size_t>>("router::num_voices", num_voices);
+
+    auto inputs = Vec<Node<Facet>*>::allocated(width);
+    auto routing_map = Voices<double>::zeros(width);
+    for (std::size_t i = 0; i < width; ++i) {
+        inputs.append(&patch.create<RandomNode>("router::random" + std::to_string(i)
+                                                , clock.pulsator, nullptr, nullptr, nullptr, nullptr, nullptr
+                                                , nullptr, nullptr, nullptr, &voices));
+        routing_map[i] = Voice<double>::singular(static_cast<double>(width - i - 1));
+    }
+
+    auto& map = patch.create<Sequence<Facet, double>>("router::routing_map", routing_map);
+    patch.observe(patch.create<RouterNode<Facet>>("router::router", width, inputs, &map));
+}
+
+
+// ==============================================================================================
+
+struct Options {
+    std::size_t num_ticks = 10000;
+    std::size_t num_warmup_ticks = 1000;
+    std::string filter;
+    std::size_t num_threads = 1;
+    double max_allocs_per_tick = 0.01;
+};
+
+
+struct Benchmark {
+    std::string name;
+    std::function<void(PatchBuilder&, std::size_t, std::size_t)> build;
+    std::vector<std::size_t> widths;
+};
+
+
+/** @return the average number of allocations per tick after warmup */
+double run(const Benchmark& benchmark, std::size_t num_voices, std::size_t width, const Options& options) {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+    graph.set_num_threads(options.num_threads);
+
+    PatchBuilder patch{root};
+    benchmark.build(patch, num_voices, width);
+    patch.build(graph);
+
+    static constexpr double TICK_INCREMENT = 0.01;
+
+    auto t = TimePoint();
+    for (std::size_t i = 0; i < options.num_warmup_ticks; ++i) {
+        graph.process(t);
+        t.increment(TICK_INCREMENT);
+    }
+
+    std::vector<long long> durations(options.num_ticks, 0);
+
+    auto allocations_before = g_num_allocations.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < options.num_ticks; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        graph.process(t);
+        auto end = std::chrono::steady_clock::now();
+
+        durations[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        t.increment(TICK_INCREMENT);
+    }
+
+    auto num_allocations = g_num_allocations.load(std::memory_order_relaxed) - allocations_before;
+
+    long double total = 0.0;
+    for (auto d: durations) {
+        total += static_cast<long double>(d);
+    }
+
+    auto num_ticks = static_cast<double>(options.num_ticks);
+    auto allocs_per_tick = static_cast<double>(num_allocations) / num_ticks;
+    auto p99_index = std::min(options.num_ticks - 1, static_cast<std::size_t>(0.99 * num_ticks));
+    std::nth_element(durations.begin(), durations.begin() + static_cast<long>(p99_index), durations.end());
+
+    std::cout << "{\"name\": \"" << benchmark.name << "\""
+              << ", \"voices\": " << num_voices
+              << ", \"width\": " << width
+              << ", \"generatives\": " << graph.size()
+              << ", \"threads\": " << options.num_threads
+              << ", \"ticks\": " << options.num_ticks
+              << ", \"ns_per_tick\": " << static_cast<double>(total) / num_ticks
+              << ", \"p99_ns\": " << durations[p99_index]
+              << ", \"allocs_per_tick\": " << allocs_per_tick
+              << "}" << std::endl;
+
+    return allocs_per_tick;
+}
+
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i += 2) {
+        std::string key = argv[i];
+        if (i + 1 == argc)
+            throw std::invalid_argument("Missing value for option: " + key);
+
+        std::string value = argv[i + 1];
+
+        if (key == "--ticks") {
+            options.num_ticks = std::stoul(value);
+        } else if (key == "--warmup") {
+            options.num_warmup_ticks = std::stoul(value);
+        } else if (key == "--filter") {
+            options.filter = value;
+        } else if (key == "--threads") {
+            options.num_threads = std::stoul(value);
+        } else if (key == "--max-allocs-per-tick") {
+            options.max_allocs_per_tick = std::stod(value);
+        } else {
+            throw std::invalid_argument("Unknown option: " + key);
+        }
+    }
+
+    if (options.num_ticks == 0)
+        throw std::invalid_argument("Number of ticks must be > 0");
+
+    return options;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\nUsage: core_benchmarks [--ticks N] [--warmup N] [--filter SUBSTRING]"
+                                 " [--threads N] [--max-allocs-per-tick X]\n";
+        return 1;
+    }
+
+    // voice counts are capped at 128 by `NodeBase::voice_count`, larger counts would only repeat the 128 row
+    const std::vector<std::size_t> voice_counts{1, 4, 16, 64, 128};
+
+    const std::vector<Benchmark> benchmarks{
+            {"chain",   build_chain,   {1}},
+            {"fan_out", build_fan_out, {4, 16}},
+            {"router",  build_router,  {2, 8, 32}},
+    };
+
+    bool allocations_exceeded = false;
+
+    for (const auto& benchmark: benchmarks) {
+        if (benchmark.name.find(options.filter) == std::string::npos)
+            continue;
+
+        for (auto width: benchmark.widths) {
+            for (auto num_voices: voice_counts) {
+                if (run(benchmark, num_voices, width, options) > options.max_allocs_per_tick) {
+                    std::cerr << benchmark.name << " (voices: " << num_voices << ", width: " << width << ")"
+                              << " exceeds " << options.max_allocs_per_tick << " allocations per tick\n";
+                    allocations_exceeded = true;
+                }
+            }
+        }
+    }
+
+    return allocations_exceeded ? 1 : 0;
+}
@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include "core/types/facet.h"
+#include "core/collections/vec.h"
 
 using namespace serialist;
 
@@ -206,6 +207,20 @@ TEST_CASE("Facet comparisons", "[facet]") {
 }
 
 
+TEST_CASE("Facet: Vec arithmetic matches scalar arithmetic", "[facet]") {
+    Vec<Facet> v{Facet(0.1), Facet(0.2), Facet(0.3), Facet(0.4), Facet(0.5)};
+
+    auto result = v.cloned().multiply(Facet(2.0)).add(Facet(0.5)).clip(Facet(0.0), Facet(1.0));
+
+    REQUIRE(result.size() == v.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        REQUIRE(result[i] == std::min(std::max(v[i] * Facet(2.0) + Facet(0.5), Facet(0.0)), Facet(1.0)));
+    }
+    REQUIRE(result.max() == Facet(1.0));
+    REQUIRE(result.min() == result[0]);
+}
+
+
 //TEST_CASE("Performance") {
 //    // Creation
 //    std::size_t n = 10'000'000;
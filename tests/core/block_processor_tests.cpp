@@ -0,0 +1,256 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "serialist/core/policies/policies.h"
+#include "core/block_processor.h"
+#include "core/types/facet.h"
+#include "core/generatives/phase_pulsator.h"
+#include "core/generatives/make_note.h"
+
+using namespace serialist;
+
+
+/** Outputs the current tick whenever an integer tick has been crossed since the previous time step */
+class TickCrossingNode : public Node<Facet> {
+public:
+    explicit TickCrossingNode(ParameterHandler& parent)
+            : m_parameter_handler(Generative::specification("ticks", "tick_crossing"), parent) {}
+
+
+    void update_time(const TimePoint& t) override { m_time = t; }
+
+
+    const Voices<Facet>& process() override {
+        if (!m_time)
+            return m_current_value;
+
+        auto tick = m_time->get_tick();
+        m_current_value = m_previous_tick && std::floor(tick) > std::floor(*m_previous_tick)
+                          ? Voices<Facet>::singular(Facet(tick))
+                          : Voices<Facet>::empty_like();
+
+        m_previous_tick = tick;
+        m_time = std::nullopt;
+        return m_current_value;
+    }
+
+
+    std::vector<Generative*> get_connected() override { return {}; }
+
+
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+
+private:
+    ParameterHandler m_parameter_handler;
+    std::optional<TimePoint> m_time;
+    std::optional<double> m_previous_tick;
+    Voices<Facet> m_current_value = Voices<Facet>::empty_like();
+};
+
+
+/** Outputs the fractional part of the current tick shifted by `offset`, i.e. a phase with a period of one tick */
+class TickPhaseNode : public Node<Facet> {
+public:
+    TickPhaseNode(ParameterHandler& parent, double offset)
+            : m_parameter_handler(Generative::specification("phase", "tick_phase"), parent)
+            , m_offset(offset) {}
+
+
+    void update_time(const TimePoint& t) override {
+        m_current_value = Voices<Facet>::singular(Facet(utils::modulo(t.get_tick() + m_offset, 1.0)));
+    }
+
+
+    const Voices<Facet>& process() override { return m_current_value; }
+
+
+    std::vector<Generative*> get_connected() override { return {}; }
+
+
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+
+private:
+    ParameterHandler m_parameter_handler;
+    double m_offset;
+    Voices<Facet> m_current_value = Voices<Facet>::empty_like();
+};
+
+
+TEST_CASE("BlockProcessor: events are reported with offset in block", "[block_processor]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto node = std::make_unique<TickCrossingNode>(root);
+    auto* node_ptr = node.get();
+    graph.add(std::move(node));
+
+    BlockProcessor<Facet> processor{graph, 4};
+    processor.add_output(*node_ptr);
+
+    REQUIRE(processor.process_block(TimePoint(0.0), TimePoint(0.8)).empty());
+
+    auto events = processor.process_block(TimePoint(0.8), TimePoint(1.6));
+    REQUIRE(events.size() == 1);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.25, 1e-8));
+    REQUIRE_THAT(events[0].time.get_tick(), Catch::Matchers::WithinAbs(1.0, 1e-8));
+    REQUIRE(events[0].output_index == 0);
+
+    SECTION("Single substep reduces to one process call at the end of each block") {
+        processor.set_num_substeps(1);
+        events = processor.process_block(TimePoint(1.6), TimePoint(2.4));
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].offset == 1.0);
+        REQUIRE_THAT(events[0].time.get_tick(), Catch::Matchers::WithinAbs(2.4, 1e-8));
+
+        REQUIRE(processor.process_block(TimePoint(2.4), TimePoint(2.8)).empty());
+    }
+
+    REQUIRE_THROWS_AS(processor.process_block(TimePoint(1.0), TimePoint(0.0)), std::invalid_argument);
+}
+
+
+TEST_CASE("BlockProcessor: triggers are reported at their crossing offset within the substep", "[block_processor]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto cursor = std::make_unique<TickPhaseNode>(root, 0.05);
+    auto durations = std::make_unique<Sequence<Facet, double>>("durations", root, 1.0);
+    auto legato = std::make_unique<Sequence<Facet, double>>("legato", root, 0.95);
+    auto pulsator = std::make_unique<PhasePulsatorNode>("pulsator", root, durations.get(), legato.get(), cursor.get());
+    auto* pulsator_ptr = pulsator.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(cursor));
+    generatives.emplace_back(std::move(durations));
+    generatives.emplace_back(std::move(legato));
+    generatives.emplace_back(std::move(pulsator));
+    graph.add(std::move(generatives));
+
+    BlockProcessor<Trigger> processor{graph, 4};
+    processor.add_output(*pulsator_ptr);
+
+    REQUIRE(processor.process_block(TimePoint(0.0), TimePoint(0.8)).empty());
+
+    // phase crosses 0.0 at tick 0.95, i.e. 3/4 into the substep (0.8, 1.0]
+    auto events = processor.process_block(TimePoint(0.8), TimePoint(1.6));
+    REQUIRE(events.size() == 1);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.1875, 1e-8));
+    REQUIRE_THAT(events[0].time.get_tick(), Catch::Matchers::WithinAbs(1.0, 1e-8));
+    REQUIRE(events[0].voices.size() == 1);
+    REQUIRE(events[0].voices[0].size() == 1);
+    REQUIRE(events[0].voices[0][0].is_pulse_on());
+    auto id = events[0].voices[0][0].get_id();
+
+    // within the substep (1.8, 2.0], the legato threshold (phase 0.95) is crossed at tick 1.9 and the next pulse
+    //   starts at tick 1.95: reported as two separate events
+    events = processor.process_block(TimePoint(1.6), TimePoint(2.4));
+    REQUIRE(events.size() == 2);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.375, 1e-8));
+    REQUIRE(events[0].voices[0] == Voice<Trigger>{Trigger::pulse_off(id)});
+    REQUIRE_THAT(events[1].offset, Catch::Matchers::WithinAbs(0.4375, 1e-8));
+    REQUIRE(events[1].voices[0].size() == 1);
+    REQUIRE(events[1].voices[0][0].is_pulse_on());
+    REQUIRE(events[0].time.get_tick() == events[1].time.get_tick());
+}
+
+
+TEST_CASE("BlockProcessor: a single substep reports triggers at their interpolated offset", "[block_processor]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto cursor = std::make_unique<TickPhaseNode>(root, 0.0);
+    auto durations = std::make_unique<Sequence<Facet, double>>("durations", root, 1.0);
+    auto legato = std::make_unique<Sequence<Facet, double>>("legato", root, 0.5);
+    auto pulsator = std::make_unique<PhasePulsatorNode>("pulsator", root, durations.get(), legato.get(), cursor.get());
+    auto* pulsator_ptr = pulsator.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(cursor));
+    generatives.emplace_back(std::move(durations));
+    generatives.emplace_back(std::move(legato));
+    generatives.emplace_back(std::move(pulsator));
+    graph.add(std::move(generatives));
+
+    BlockProcessor<Trigger> processor{graph};
+    processor.add_output(*pulsator_ptr);
+
+    // blocks well below PhasePulsator's jump detection threshold
+    Vec<double> boundaries{0.0, 0.2, 0.4, 0.6, 0.8, 0.95};
+    for (std::size_t i = 1; i < boundaries.size(); ++i) {
+        REQUIRE(processor.process_block(TimePoint(boundaries[i - 1]), TimePoint(boundaries[i])).empty());
+    }
+
+    // phase crosses 0.0 at tick 1.0, i.e. 1/4 into the block
+    auto events = processor.process_block(TimePoint(0.95), TimePoint(1.15));
+    REQUIRE(events.size() == 1);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.25, 1e-8));
+    REQUIRE_THAT(events[0].time.get_tick(), Catch::Matchers::WithinAbs(1.15, 1e-8));
+    REQUIRE(events[0].voices[0].size() == 1);
+    REQUIRE(events[0].voices[0][0].is_pulse_on());
+    auto id = events[0].voices[0][0].get_id();
+
+    REQUIRE(processor.process_block(TimePoint(1.15), TimePoint(1.35)).empty());
+
+    // legato threshold (phase 0.5) is crossed at tick 1.5, i.e. 3/4 into the block
+    events = processor.process_block(TimePoint(1.35), TimePoint(1.55));
+    REQUIRE(events.size() == 1);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.75, 1e-8));
+    REQUIRE(events[0].voices[0] == Voice<Trigger>{Trigger::pulse_off(id)});
+}
+
+
+TEST_CASE("BlockProcessor: notes are reported at the offset of their trigger", "[block_processor]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto cursor = std::make_unique<TickPhaseNode>(root, 0.0);
+    auto durations = std::make_unique<Sequence<Facet, double>>("durations", root, 1.0);
+    auto legato = std::make_unique<Sequence<Facet, double>>("legato", root, 0.5);
+    auto pulsator = std::make_unique<PhasePulsatorNode>("pulsator", root, durations.get(), legato.get(), cursor.get());
+    auto note_number = std::make_unique<Sequence<Facet, NoteNumber>>("note_number", root, Voices<NoteNumber>::singular(60));
+    auto velocity = std::make_unique<Sequence<Facet, uint32_t>>("velocity", root, Voices<uint32_t>::singular(100));
+    auto channel = std::make_unique<Sequence<Facet, uint32_t>>("channel", root, Voices<uint32_t>::singular(1));
+    auto make_note = std::make_unique<MakeNoteNode>("make_note"
+                                                    , root
+                                                    , pulsator.get()
+                                                    , note_number.get()
+                                                    , velocity.get()
+                                                    , channel.get());
+    auto* make_note_ptr = make_note.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(cursor));
+    generatives.emplace_back(std::move(durations));
+    generatives.emplace_back(std::move(legato));
+    generatives.emplace_back(std::move(pulsator));
+    generatives.emplace_back(std::move(note_number));
+    generatives.emplace_back(std::move(velocity));
+    generatives.emplace_back(std::move(channel));
+    generatives.emplace_back(std::move(make_note));
+    graph.add(std::move(generatives));
+
+    BlockProcessor<Event> processor{graph};
+    processor.add_output(*make_note_ptr);
+
+    // blocks well below PhasePulsator's jump detection threshold
+    Vec<double> boundaries{0.0, 0.2, 0.4, 0.6, 0.8, 0.95};
+    for (std::size_t i = 1; i < boundaries.size(); ++i) {
+        REQUIRE(processor.process_block(TimePoint(boundaries[i - 1]), TimePoint(boundaries[i])).empty());
+    }
+
+    auto events = processor.process_block(TimePoint(0.95), TimePoint(1.15));
+    REQUIRE(events.size() == 1);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.25, 1e-8));
+    REQUIRE(events[0].voices[0].size() == 1);
+    REQUIRE(events[0].voices[0][0].as<MidiNoteEvent>().note_number == 60);
+    REQUIRE(events[0].voices[0][0].as<MidiNoteEvent>().velocity == 100);
+
+    REQUIRE(processor.process_block(TimePoint(1.15), TimePoint(1.35)).empty());
+
+    events = processor.process_block(TimePoint(1.35), TimePoint(1.55));
+    REQUIRE(events.size() == 1);
+    REQUIRE_THAT(events[0].offset, Catch::Matchers::WithinAbs(0.75, 1e-8));
+    REQUIRE(events[0].voices[0].size() == 1);
+    REQUIRE(events[0].voices[0][0].as<MidiNoteEvent>().note_number == 60);
+    REQUIRE(events[0].voices[0][0].as<MidiNoteEvent>().velocity == 0);
+}
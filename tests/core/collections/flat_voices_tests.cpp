@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/collections/flat_voices.h"
+
+using namespace serialist;
+
+TEST_CASE("FlatVoices: conversion to and from Voices", "[flat_voices]") {
+    Voices<int> voices{{1, 2, 3}, {}, {4, 5}, {6}};
+
+    FlatVoices<int> flat(voices);
+    REQUIRE(flat.size() == 4);
+    REQUIRE(flat.numel() == 6);
+    REQUIRE(flat.values() == Vec<int>{1, 2, 3, 4, 5, 6});
+    REQUIRE(flat.offsets() == Vec<std::size_t>{0, 3, 3, 5, 6});
+
+    REQUIRE(flat[0].size() == 3);
+    REQUIRE(flat[1].empty());
+    REQUIRE(flat[2][1] == 5);
+
+    REQUIRE(flat.to_voices() == voices);
+
+    REQUIRE(FlatVoices<int>::empty_like().is_empty_like());
+    REQUIRE(FlatVoices<int>::empty_like().to_voices() == Voices<int>::empty_like());
+    REQUIRE(FlatVoices<int>(Voices<int>::zeros(3)) == FlatVoices<int>::zeros(3));
+
+    REQUIRE_THROWS_AS(FlatVoices<int>(Vec<int>{1, 2}, Vec<std::size_t>{0, 1}), std::invalid_argument);
+    REQUIRE_THROWS_AS(FlatVoices<int>(Vec<int>{1, 2}, Vec<std::size_t>{0, 2, 1, 2}), std::invalid_argument);
+    REQUIRE_THROWS_AS(FlatVoices<int>::zeros(0), std::invalid_argument);
+}
+
+
+TEST_CASE("FlatVoices: adapted_to matches Voices", "[flat_voices]") {
+    Voices<int> voices{{1, 2}, {}, {3}};
+
+    for (std::size_t num_voices: {1, 2, 3, 4, 7}) {
+        auto expected = voices.cloned().adapted_to(num_voices);
+        auto flat = FlatVoices<int>(voices).adapted_to(num_voices);
+        REQUIRE(flat.to_voices() == expected);
+    }
+
+    auto flat = FlatVoices<int>(voices);
+    REQUIRE(flat.adapted_to(FlatVoices<int>::AUTO_VOICES) == FlatVoices<int>(voices));
+}
+
+
+TEST_CASE("FlatVoices: adapting to zero voices keeps the existing voices", "[flat_voices]") {
+    Voices<int> voices{{1, 2}, {}, {3}};
+
+    auto flat = FlatVoices<int>(voices);
+    REQUIRE(flat.adapted_to(0).size() == 3);
+    REQUIRE(flat.adapted_to(5).to_voices() == voices.cloned().adapted_to(5));
+
+    auto single = FlatVoices<int>::empty_like();
+    REQUIRE(single.adapted_to(0).size() == 1);
+    REQUIRE(single.adapted_to(4) == FlatVoices<int>::zeros(4));
+
+    auto from = FlatVoices<int>::adapted_from(Voices<double>::empty_like(), 0);
+    REQUIRE(from.size() == 1);
+    REQUIRE(from.adapted_to(3) == FlatVoices<int>::zeros(3));
+}
+
+
+TEST_CASE("FlatVoices: adapted_from matches adapted_to and as_type on Voices", "[flat_voices]") {
+    Voices<double> voices{{1.5, 2.5}, {}, {3.5}};
+
+    for (std::size_t num_voices: {0, 1, 2, 3, 4, 7}) {
+        auto expected = voices.cloned().adapted_to(num_voices).as_type<int>();
+        REQUIRE(FlatVoices<int>::adapted_from(voices, num_voices).to_voices() == expected);
+    }
+}
+
+
+TEST_CASE("FlatVoices: merge_uneven matches Voices", "[flat_voices]") {
+    Voices<int> a{{1}, {2, 3}};
+    Voices<int> b{{4}, {}, {5, 6}};
+
+    for (bool allow_expand: {false, true}) {
+        for (std::size_t offset: {0, 1, 3}) {
+            auto expected = a.cloned().merge_uneven(b, allow_expand, offset);
+            auto flat = FlatVoices<int>(a).merge_uneven(FlatVoices<int>(b), allow_expand, offset);
+            REQUIRE(flat.to_voices() == expected);
+        }
+    }
+}
+
+
+TEST_CASE("FlatVoices: firsts_or, flattened and transpose match Voices", "[flat_voices]") {
+    Voices<int> voices{{1, 2, 3}, {}, {4, 5}, {6}};
+    FlatVoices<int> flat(voices);
+
+    REQUIRE(flat.firsts_or(-1) == voices.firsts_or(-1));
+    REQUIRE(flat.firsts_or<double>(-1.0) == voices.firsts_or<double>(-1.0));
+    REQUIRE(flat.flattened() == voices.flattened());
+    REQUIRE(flat.transpose().to_voices() == voices.transpose());
+
+    REQUIRE(FlatVoices<int>::zeros(3).transpose() == FlatVoices<std::optional<int> >::empty_like());
+}
+
+
+TEST_CASE("FlatVoices: kernels over all values", "[flat_voices]") {
+    FlatVoices<double> flat(Voices<double>{{0.1, 0.2}, {0.3}});
+
+    for (auto& value: flat.values_mut()) {
+        value *= 2.0;
+    }
+
+    REQUIRE(flat.to_voices() == Voices<double>{{0.2, 0.4}, {0.6}});
+}
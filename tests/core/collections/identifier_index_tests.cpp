@@ -0,0 +1,75 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/collections/identifier_index.h"
+
+using namespace serialist;
+
+TEST_CASE("IdentifierIndex: find exact identifier", "[identifier_index]") {
+    IdentifierIndex<int> index;
+    index.insert("osc", 1);
+    index.insert("osc::freq", 2);
+    index.insert("osc1", 3);
+
+    REQUIRE(index.size() == 3);
+    REQUIRE(index.find("osc") == 1);
+    REQUIRE(index.find("osc::freq") == 2);
+    REQUIRE(index.find("osc1") == 3);
+    REQUIRE_FALSE(index.find("os").has_value());
+    REQUIRE_FALSE(index.find("osc::phase").has_value());
+}
+
+
+TEST_CASE("IdentifierIndex: find matching base identifier", "[identifier_index]") {
+    IdentifierIndex<int> index;
+    index.insert("osc", 1);
+    index.insert("osc::freq", 2);
+    index.insert("osc::freq::value", 3);
+    index.insert("osc1", 4);
+    index.insert("osc1::freq", 5);
+
+    auto matching = index.find_matching("osc");
+    std::sort(matching.begin(), matching.end());
+    REQUIRE(matching == std::vector<int>{1, 2, 3});
+
+    matching = index.find_matching("osc::freq");
+    std::sort(matching.begin(), matching.end());
+    REQUIRE(matching == std::vector<int>{2, 3});
+
+    REQUIRE(index.find_matching("os").empty());
+
+    SECTION("Children are matched even if base identifier is not indexed") {
+        index.insert("a::b", 6);
+        REQUIRE_FALSE(index.find("a").has_value());
+        REQUIRE(index.find_matching("a") == std::vector<int>{6});
+    }
+
+    SECTION("Matches are returned in insertion order") {
+        IdentifierIndex<int> ordered;
+        std::vector<int> expected;
+        for (int i = 0; i < 50; ++i) {
+            ordered.insert("root::" + std::to_string(49 - i) + "::value", i);
+            ordered.insert("root", 100 + i);
+            expected.push_back(i);
+            expected.push_back(100 + i);
+        }
+        REQUIRE(ordered.find_matching("root") == expected);
+    }
+}
+
+
+TEST_CASE("IdentifierIndex: remove", "[identifier_index]") {
+    IdentifierIndex<int> index;
+    index.insert("osc", 1);
+    index.insert("osc::freq", 2);
+
+    REQUIRE_FALSE(index.remove("osc", 2));
+    REQUIRE_FALSE(index.remove("osc::phase", 2));
+
+    REQUIRE(index.remove("osc::freq", 2));
+    REQUIRE(index.size() == 1);
+    REQUIRE(index.find_matching("osc") == std::vector<int>{1});
+
+    REQUIRE(index.remove("osc", 1));
+    REQUIRE(index.empty());
+    REQUIRE(index.find_matching("osc").empty());
+}
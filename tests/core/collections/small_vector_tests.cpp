@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+#include "core/collections/small_vector.h"
+#include "core/collections/vec.h"
+
+using namespace serialist;
+
+TEST_CASE("SmallVector: elements are stored inline until capacity is exceeded", "[small_vector]") {
+    SmallVector<int, 4> v;
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() == 4);
+
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    REQUIRE(v.is_inline());
+    REQUIRE(v == SmallVector<int, 4>{0, 1, 2, 3});
+
+    v.push_back(4);
+    REQUIRE_FALSE(v.is_inline());
+    REQUIRE(v.capacity() >= 5);
+    REQUIRE(v == SmallVector<int, 4>{0, 1, 2, 3, 4});
+
+    v.clear();
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() >= 5);
+}
+
+
+TEST_CASE("SmallVector: insert and erase", "[small_vector]") {
+    SmallVector<int, 4> v{1, 2, 3};
+
+    v.insert(v.begin() + 1, 7);
+    REQUIRE(v == SmallVector<int, 4>{1, 7, 2, 3});
+
+    // insertion causing reallocation, with values referring to the vector itself
+    v.insert(v.end(), v.begin(), v.end());
+    REQUIRE(v == SmallVector<int, 4>{1, 7, 2, 3, 1, 7, 2, 3});
+
+    v.insert(v.begin(), 2, v.back());
+    REQUIRE(v == SmallVector<int, 4>{3, 3, 1, 7, 2, 3, 1, 7, 2, 3});
+
+    v.erase(v.begin(), v.begin() + 4);
+    REQUIRE(v == SmallVector<int, 4>{2, 3, 1, 7, 2, 3});
+
+    v.erase(v.begin() + 1);
+    REQUIRE(v == SmallVector<int, 4>{2, 1, 7, 2, 3});
+
+    v.resize(2);
+    REQUIRE(v == SmallVector<int, 4>{2, 1});
+
+    v.resize(4, 9);
+    REQUIRE(v == SmallVector<int, 4>{2, 1, 9, 9});
+
+    REQUIRE_THROWS_AS(v.at(4), std::out_of_range);
+}
+
+
+TEST_CASE("SmallVector: copy and move", "[small_vector]") {
+    SmallVector<std::string, 2> small{"a", "b"};
+    SmallVector<std::string, 2> large{"a", "b", "c"};
+
+    auto small_copy = small;
+    auto large_copy = large;
+    REQUIRE(small_copy == small);
+    REQUIRE(large_copy == large);
+
+    auto moved_small = std::move(small);
+    REQUIRE(moved_small == small_copy);
+    REQUIRE(small.empty());
+
+    // heap buffer is transferred rather than copied
+    const auto* large_data = large.data();
+    auto moved_large = std::move(large);
+    REQUIRE(moved_large.data() == large_data);
+    REQUIRE(large.empty());
+    REQUIRE(large.is_inline());
+
+    moved_small.swap(moved_large);
+    REQUIRE(moved_small == large_copy);
+    REQUIRE(moved_large == small_copy);
+
+    SmallVector<std::unique_ptr<int>, 2> unique;
+    unique.emplace_back(std::make_unique<int>(1));
+    unique.emplace_back(std::make_unique<int>(2));
+    unique.emplace_back(std::make_unique<int>(3));
+    auto moved_unique = std::move(unique);
+    REQUIRE(*moved_unique[2] == 3);
+}
+
+
+TEST_CASE("SmallVector: elements are destroyed exactly once", "[small_vector]") {
+    auto counter = std::make_shared<int>(0);
+    {
+        SmallVector<std::shared_ptr<int>, 2> v;
+        for (int i = 0; i < 5; ++i) {
+            v.push_back(counter);
+        }
+        REQUIRE(counter.use_count() == 6);
+
+        v.erase(v.begin(), v.begin() + 2);
+        REQUIRE(counter.use_count() == 4);
+
+        auto copy = v;
+        REQUIRE(counter.use_count() == 7);
+    }
+    REQUIRE(counter.use_count() == 1);
+}
+
+
+TEST_CASE("Vec: voices of small elements don't allocate", "[small_vector]") {
+    REQUIRE(Vec<double>::INLINE_CAPACITY == 4);
+    REQUIRE(Vec<Vec<double>>::INLINE_CAPACITY == 0);
+
+    auto v = Vec<double>({1.0, 2.0});
+    REQUIRE(v.vector().is_inline());
+    REQUIRE(v.cloned().vector().is_inline());
+    REQUIRE(v.as_type<int>().vector().is_inline());
+}
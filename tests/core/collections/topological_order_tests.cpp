@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+
+#include "core/collections/topological_order.h"
+
+using namespace serialist;
+
+
+static std::vector<int> ordered(const TopologicalOrder<int>& order) {
+    std::vector<int> nodes;
+    order.for_each([&nodes](int node) { nodes.push_back(node); });
+    return nodes;
+}
+
+
+static bool respects(const std::vector<int>& nodes, const std::vector<std::pair<int, int>>& edges) {
+    for (const auto& [from, to]: edges) {
+        auto from_it = std::find(nodes.begin(), nodes.end(), from);
+        auto to_it = std::find(nodes.begin(), nodes.end(), to);
+        if (from_it == nodes.end() || to_it == nodes.end() || from_it >= to_it)
+            return false;
+    }
+    return true;
+}
+
+
+TEST_CASE("TopologicalOrder: nodes are kept in insertion order unless edges require otherwise", "[topological_order]") {
+    TopologicalOrder<int> order;
+    for (int i = 0; i < 5; ++i) {
+        order.insert(i);
+    }
+    order.insert(2);
+
+    REQUIRE(order.size() == 5);
+    REQUIRE(ordered(order) == std::vector<int>{0, 1, 2, 3, 4});
+
+    REQUIRE(order.add_edge(1, 3));
+    REQUIRE(ordered(order) == std::vector<int>{0, 1, 2, 3, 4});
+
+    // only the nodes between the two endpoints that are connected to either of them are moved
+    REQUIRE(order.add_edge(3, 0));
+    REQUIRE(ordered(order) == std::vector<int>{1, 3, 2, 0, 4});
+    REQUIRE(respects(ordered(order), {{1, 3}, {3, 0}}));
+}
+
+
+TEST_CASE("TopologicalOrder: cyclic edges are kept aside until the cycle is broken", "[topological_order]") {
+    TopologicalOrder<int> order;
+    for (int i = 0; i < 3; ++i) {
+        order.insert(i);
+    }
+
+    REQUIRE(order.add_edge(0, 1));
+    REQUIRE(order.add_edge(1, 2));
+    REQUIRE_FALSE(order.add_edge(2, 0));
+    REQUIRE_FALSE(order.add_edge(1, 1));
+    REQUIRE(order.cyclic_edges() == std::vector<std::pair<int, int>>{{2, 0}, {1, 1}});
+    REQUIRE(order.successors(1) == std::vector<int>{2});
+
+    order.remove_edge(1, 1);
+    REQUIRE(order.cyclic_edges() == std::vector<std::pair<int, int>>{{2, 0}});
+
+    SECTION("removing an edge") {
+        order.remove_edge(0, 1);
+        REQUIRE(order.cyclic_edges().empty());
+        REQUIRE(respects(ordered(order), {{1, 2}, {2, 0}}));
+    }
+
+    SECTION("removing a node") {
+        order.erase(1);
+        REQUIRE(order.cyclic_edges().empty());
+        REQUIRE(ordered(order) == std::vector<int>{2, 0});
+        REQUIRE(order.successors(0).empty());
+    }
+}
+
+
+TEST_CASE("TopologicalOrder: random edits", "[topological_order]") {
+    static constexpr int NUM_NODES = 60;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> node(0, NUM_NODES - 1);
+
+    TopologicalOrder<int> order;
+    for (int i = 0; i < NUM_NODES; ++i) {
+        order.insert(i);
+    }
+
+    std::vector<std::pair<int, int>> edges;
+    for (std::size_t step = 0; step < 2000; ++step) {
+        if (step % 3 == 2 && !edges.empty()) {
+            auto index = std::uniform_int_distribution<std::size_t>(0, edges.size() - 1)(rng);
+            order.remove_edge(edges[index].first, edges[index].second);
+            edges.erase(edges.begin() + static_cast<long>(index));
+        } else {
+            auto from = node(rng);
+            auto to = node(rng);
+            order.add_edge(from, to);
+            edges.emplace_back(from, to);
+        }
+
+        // every edge is either part of the order or cyclic
+        std::vector<std::pair<int, int>> ordered_edges;
+        auto cyclic = order.cyclic_edges();
+        for (const auto& edge: edges) {
+            auto it = std::find(cyclic.begin(), cyclic.end(), edge);
+            if (it != cyclic.end()) {
+                cyclic.erase(it);
+            } else {
+                ordered_edges.push_back(edge);
+            }
+        }
+        REQUIRE(cyclic.empty());
+        REQUIRE(respects(ordered(order), ordered_edges));
+    }
+}
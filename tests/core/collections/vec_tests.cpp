@@ -372,14 +372,16 @@ TEST_CASE("Vec empty", "[empty]") {
 TEST_CASE("Vec vector and vector_mut", "[vector]") {
     Vec v = {1, 2, 3, 4, 5};
 
-    const std::vector<int>& constVector = v.vector();
+    const auto& constVector = v.vector();
     REQUIRE(constVector.size() == 5);
     REQUIRE(constVector[0] == 1);
 
-    std::vector<int>& mutableVector = v.vector_mut();
+    auto& mutableVector = v.vector_mut();
     mutableVector.push_back(6);
     REQUIRE(v.size() == 6);
     REQUIRE(v[5] == 6);
+
+    REQUIRE(v.to_std_vector() == std::vector<int>{1, 2, 3, 4, 5, 6});
 }
 
 
@@ -717,7 +719,7 @@ TEST_CASE("Test map function", "[map]") {
 
     v.map(double_fn);
 
-    REQUIRE(v.vector() == std::vector<int>({2, 4, 6, 8, 10}));
+    REQUIRE(v == Vec<int>({2, 4, 6, 8, 10}));
 }
 
 
@@ -728,7 +730,7 @@ TEST_CASE("Test filter function", "[filter]") {
 
     v.filter(even_fn);
 
-    REQUIRE(v.vector() == std::vector<int>({2, 4}));
+    REQUIRE(v == Vec<int>({2, 4}));
 }
 
 
@@ -745,8 +747,24 @@ TEST_CASE("Test filter_drain function", "[filter_drain]") {
     auto even_fn = [](int x) { return x % 2 == 0; };
     Vec<int> drained = v.filter_drain(even_fn);
 
-    REQUIRE(v.vector() == std::vector<int>({2, 4}));
-    REQUIRE(drained.vector() == std::vector<int>({1, 3, 5}));
+    REQUIRE(v == Vec<int>({2, 4}));
+    REQUIRE(drained == Vec<int>({1, 3, 5}));
+
+    // move-only elements keep their relative order
+    Vec<std::unique_ptr<int>> pointers;
+    for (int i = 0; i < 6; ++i) {
+        pointers.append(std::make_unique<int>(i));
+    }
+    auto drained_pointers = pointers.filter_drain([](const std::unique_ptr<int>& p) { return *p >= 3; });
+    REQUIRE(pointers.size() == 3);
+    REQUIRE(drained_pointers.size() == 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        REQUIRE(*pointers[i] == static_cast<int>(i) + 3);
+        REQUIRE(*drained_pointers[i] == static_cast<int>(i));
+    }
+
+    REQUIRE(Vec<int>({2, 4}).filter_drain(even_fn).empty());
+    REQUIRE(Vec<int>().filter_drain(even_fn).empty());
 }
 
 
@@ -785,12 +803,36 @@ TEST_CASE("Vec normalize_l2", "[normalize_l2]") {
 }
 
 
+TEST_CASE("Vec vectorized arithmetic matches element-wise results", "[add][multiply][clip][sum]") {
+    // odd size, to cover both full SIMD batches and the scalar remainder
+    Vec<double> a = {-3.0, -2.5, -1.0, -0.5, 0.0, 0.25, 1.0, 2.0, 4.5, 8.0, 16.0};
+    Vec<double> b = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0};
+
+    auto result = a.cloned().add(1.0).multiply(b).subtract(b).divide(2.0).clip(-1.0, 50.0);
+
+    REQUIRE(result.size() == a.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        auto expected = std::min(std::max(((a[i] + 1.0) * b[i] - b[i]) / 2.0, -1.0), 50.0);
+        REQUIRE(result[i] == expected);
+    }
+
+    REQUIRE_THAT(a.sum(), Catch::Matchers::WithinAbs(24.75, 1e-12));
+    REQUIRE(a.max() == 16.0);
+    REQUIRE(a.min() == -3.0);
+    REQUIRE_THAT(a.mean(), Catch::Matchers::WithinAbs(24.75 / 11.0, 1e-12));
+    REQUIRE_THAT(b.cloned().normalize_l1().sum(), Catch::Matchers::WithinAbs(1.0, 1e-12));
+    REQUIRE_THAT(b.cloned().normalize_max().max(), Catch::Matchers::WithinAbs(1.0, 1e-12));
+
+    REQUIRE_THROWS_AS(a.cloned().add(Vec<double>{1.0, 2.0}), std::logic_error);
+}
+
+
 TEST_CASE("Test extend function", "[extend]") {
     Vec v1({1, 2, 3});
     Vec v2({4, 5, 6});
     v1.extend(v2);
 
-    REQUIRE(v1.vector() == std::vector<int>({1, 2, 3, 4, 5, 6}));
+    REQUIRE(v1 == Vec<int>({1, 2, 3, 4, 5, 6}));
 }
 
 
@@ -863,17 +905,17 @@ TEST_CASE("Test linspace function") {
 //
 //    SECTION("Rotate right by 2 elements") {
 //        v.rotate(2);
-//        REQUIRE(v.vector() == std::vector<int>({4, 5, 1, 2, 3}));
+//        REQUIRE(v == Vec<int>({4, 5, 1, 2, 3}));
 //    }
 //
 //    SECTION("Rotate left by 1 element") {
 //        v.rotate(-1);
-//        REQUIRE(v.vector() == std::vector<int>({2, 3, 4, 5, 1}));
+//        REQUIRE(v == Vec<int>({2, 3, 4, 5, 1}));
 //    }
 //
 //    SECTION("No rotation (amount is 0)") {
 //        v.rotate(0);
-//        REQUIRE(v.vector() == std::vector<int>({1, 2, 3, 4, 5}));
+//        REQUIRE(v == Vec<int>({1, 2, 3, 4, 5}));
 //    }
 //}
 
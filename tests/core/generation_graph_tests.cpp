@@ -0,0 +1,878 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "serialist/core/policies/policies.h"
+#include "core/generation_graph.h"
+#include "core/generatives/scaler.h"
+#include "core/generatives/sequence.h"
+
+using namespace serialist;
+
+
+class CountingNode : public Node<Facet> {
+public:
+    CountingNode(const std::string& id, ParameterHandler& parent)
+            : m_parameter_handler(Generative::specification(id, "counting"), parent) {}
+
+
+    const Voices<Facet>& process() override {
+        ++m_num_calls;
+        return m_value;
+    }
+
+
+    std::vector<Generative*> get_connected() override { return {}; }
+
+
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+
+
+    std::size_t num_calls() const { return m_num_calls; }
+
+
+    void set_destruction_flag(bool* destroyed) { m_destroyed = destroyed; }
+
+
+    ~CountingNode() override {
+        if (m_destroyed)
+            *m_destroyed = true;
+    }
+
+private:
+    ParameterHandler m_parameter_handler;
+    Voices<Facet> m_value = Voices<Facet>::singular(Facet(0.5));
+    std::size_t m_num_calls = 0;
+    bool* m_destroyed = nullptr;
+};
+
+
+class DependentNode : public Node<Facet> {
+public:
+    DependentNode(const std::string& id, ParameterHandler& parent)
+            : m_parameter_handler(Generative::specification(id, "dependent"), parent) {}
+
+
+    const Voices<Facet>& process() override { return m_value; }
+
+
+    std::vector<Generative*> get_connected() override { return m_dependencies; }
+
+
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+
+
+    void depend_on(Generative& generative) { m_dependencies.push_back(&generative); }
+
+private:
+    ParameterHandler m_parameter_handler;
+    Voices<Facet> m_value = Voices<Facet>::singular(Facet(0.0));
+    std::vector<Generative*> m_dependencies;
+};
+
+
+/** Output only depends on its dependencies, counts the number of times it's processed */
+class PureNode : public DependentNode {
+public:
+    using DependentNode::DependentNode;
+
+
+    const Voices<Facet>& process() override {
+        ++m_num_calls;
+        return DependentNode::process();
+    }
+
+
+    bool is_time_dependent() const override { return false; }
+
+
+    std::size_t num_calls() const { return m_num_calls; }
+
+private:
+    std::size_t m_num_calls = 0;
+};
+
+
+/** Records the time it receives, either through `update_time` or by following a TimeFrame */
+class TimedNode : public CountingNode {
+public:
+    TimedNode(const std::string& id, ParameterHandler& parent, bool follows_frame)
+            : CountingNode(id, parent), m_follows_frame(follows_frame), m_gate(m_source) {}
+
+
+    void update_time(const TimePoint& t) override {
+        ++m_num_time_updates;
+        m_source.update_time(t);
+    }
+
+
+    bool bind_time_frame(const TimeFrame* frame) override {
+        if (!m_follows_frame)
+            return false;
+        m_source.bind(frame);
+        return true;
+    }
+
+
+    std::optional<double> pop_tick() {
+        if (auto* t = m_gate.pop_time())
+            return t->get_tick();
+        return std::nullopt;
+    }
+
+
+    std::size_t num_time_updates() const { return m_num_time_updates; }
+
+private:
+    bool m_follows_frame;
+    TimeFrameSource m_source;
+    TimeGate m_gate;
+    std::size_t m_num_time_updates = 0;
+};
+
+
+/** Holds a single pulse, which is released by `flush`. Records the output of its latest evaluation */
+class HoldingNode : public Node<Trigger> {
+public:
+    HoldingNode(const std::string& id, ParameterHandler& parent, std::optional<std::size_t> held_id)
+            : m_parameter_handler(Generative::specification(id, "holding"), parent), m_held_id(held_id) {}
+
+
+    const Voices<Trigger>& process() override { return m_value; }
+
+
+    void evaluate() override {
+        Node<Trigger>::evaluate();
+        m_latest = *output();
+    }
+
+
+    Voices<Trigger> flush() override {
+        if (!m_held_id)
+            return Voices<Trigger>::empty_like();
+
+        auto id = *m_held_id;
+        m_held_id = std::nullopt;
+        return Voices<Trigger>::singular(Trigger::pulse_off(id));
+    }
+
+
+    std::vector<Generative*> get_connected() override { return {}; }
+
+
+    ParameterHandler& get_parameter_handler() override { return m_parameter_handler; }
+
+
+    const Voices<Trigger>& latest() const { return m_latest; }
+
+private:
+    ParameterHandler m_parameter_handler;
+    std::optional<std::size_t> m_held_id;
+    Voices<Trigger> m_value = Voices<Trigger>::empty_like();
+    Voices<Trigger> m_latest = Voices<Trigger>::empty_like();
+};
+
+
+// ==============================================================================================
+
+TEST_CASE("GenerationGraph: schedule respects dependencies", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto counter = std::make_unique<CountingNode>("counter", root);
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto scaler = std::make_unique<ScalerNode>("scaler", root, trigger.get(), counter.get());
+
+    auto* counter_ptr = counter.get();
+    auto* trigger_ptr = trigger.get();
+    auto* scaler_ptr = scaler.get();
+
+    // insert dependent before its dependencies
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(scaler));
+    generatives.emplace_back(std::move(counter));
+    generatives.emplace_back(std::move(trigger));
+    graph.add(std::move(generatives));
+    graph.observe(*scaler_ptr);
+
+    const auto& schedule = graph.get_schedule();
+    REQUIRE(schedule.size() == 3);
+
+    auto position_of = [&schedule](const Generative* g) {
+        return std::distance(schedule.begin(), std::find(schedule.begin(), schedule.end(), g));
+    };
+
+    REQUIRE(position_of(counter_ptr) < position_of(scaler_ptr));
+    REQUIRE(position_of(trigger_ptr) < position_of(scaler_ptr));
+
+    SECTION("Every generative is evaluated exactly once per cycle") {
+        auto t = TimePoint();
+        for (std::size_t i = 0; i < 10; ++i) {
+            graph.process(t);
+            t.increment(0.1);
+            REQUIRE(counter_ptr->num_calls() == i + 1);
+        }
+
+        // output slots are only valid within a cycle
+        REQUIRE(scaler_ptr->output() == nullptr);
+        REQUIRE(scaler_ptr->process().size() == 1);
+    }
+
+    SECTION("Removing a generative updates the schedule") {
+        graph.remove(*scaler_ptr);
+        REQUIRE(graph.size() == 2);
+
+        // no longer reachable from any observed generative
+        REQUIRE(graph.get_schedule().empty());
+    }
+}
+
+
+TEST_CASE("GraphUtils: topological order of chain", "[generation_graph]") {
+    ParameterHandler root;
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto a = std::make_unique<ScalerNode>("a", root, trigger.get());
+    auto b = std::make_unique<ScalerNode>("b", root, trigger.get(), a.get());
+    auto c = std::make_unique<ScalerNode>("c", root, trigger.get(), b.get());
+
+    std::vector<Generative*> expected{trigger.get(), a.get(), b.get(), c.get()};
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(c));
+    generatives.emplace_back(std::move(b));
+    generatives.emplace_back(std::move(a));
+    generatives.emplace_back(std::move(trigger));
+
+    REQUIRE(GraphUtils::topological_order(generatives) == expected);
+}
+
+
+TEST_CASE("GenerationGraph: parallel processing of independent chains", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    std::vector<CountingNode*> counters;
+    std::vector<ScalerNode*> scalers;
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    for (std::size_t i = 0; i < 16; ++i) {
+        auto counter = std::make_unique<CountingNode>("counter" + std::to_string(i), root);
+        auto scaler = std::make_unique<ScalerNode>("scaler" + std::to_string(i), root, trigger.get(), counter.get());
+        counters.push_back(counter.get());
+        scalers.push_back(scaler.get());
+        generatives.emplace_back(std::move(scaler));
+        generatives.emplace_back(std::move(counter));
+    }
+    generatives.emplace_back(std::move(trigger));
+    graph.add(std::move(generatives));
+
+    for (auto* scaler: scalers) {
+        graph.observe(*scaler);
+    }
+
+    graph.set_num_threads(4);
+    REQUIRE(graph.get_num_threads() == 4);
+
+    auto t = TimePoint();
+    for (std::size_t i = 0; i < 20; ++i) {
+        graph.process(t);
+        t.increment(0.1);
+    }
+
+    for (auto* counter: counters) {
+        REQUIRE(counter->num_calls() == 20);
+    }
+
+    graph.set_num_threads(1);
+    REQUIRE(graph.get_num_threads() == 1);
+}
+
+
+TEST_CASE("GraphUtils: topological levels", "[generation_graph]") {
+    ParameterHandler root;
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto a = std::make_unique<ScalerNode>("a", root, trigger.get());
+    auto b = std::make_unique<ScalerNode>("b", root, trigger.get());
+    auto c = std::make_unique<ScalerNode>("c", root, trigger.get(), a.get());
+
+    auto* trigger_ptr = trigger.get();
+    auto* a_ptr = a.get();
+    auto* b_ptr = b.get();
+    auto* c_ptr = c.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(c));
+    generatives.emplace_back(std::move(b));
+    generatives.emplace_back(std::move(a));
+    generatives.emplace_back(std::move(trigger));
+
+    auto levels = GraphUtils::topological_levels(generatives);
+    REQUIRE(levels.unordered.empty());
+    REQUIRE(levels.levels.size() == 3);
+    REQUIRE(levels.levels[0] == std::vector<Generative*>{trigger_ptr});
+    REQUIRE(levels.levels[1] == std::vector<Generative*>{b_ptr, a_ptr});
+    REQUIRE(levels.levels[2] == std::vector<Generative*>{c_ptr});
+}
+
+
+TEST_CASE("GenerationGraph: removed generatives outlive the cycle processing them", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    bool destroyed = false;
+    auto counter = std::make_unique<CountingNode>("counter", root);
+    counter->set_destruction_flag(&destroyed);
+    auto* counter_ptr = counter.get();
+
+    graph.add(std::move(counter));
+    graph.process(TimePoint());
+
+    graph.remove(*counter_ptr);
+    REQUIRE(graph.size() == 0);
+    REQUIRE(graph.get_schedule().empty());
+
+    // `process` may still be using the previous snapshot
+    REQUIRE_FALSE(destroyed);
+
+    // once `process` has picked up the new snapshot, the generative is reclaimed on the next edit
+    graph.process(TimePoint());
+    graph.update_schedule();
+    REQUIRE(destroyed);
+}
+
+
+TEST_CASE("GenerationGraph: edits concurrent with processing", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+    graph.set_num_threads(2);
+
+    std::atomic<bool> running{true};
+    std::thread process_thread([&graph, &running] {
+        auto t = TimePoint();
+        while (running) {
+            graph.process(t);
+            t.increment(0.01);
+        }
+    });
+
+    for (std::size_t i = 0; i < 200; ++i) {
+        auto trigger = std::make_unique<Sequence<Trigger>>("trigger" + std::to_string(i), root, Trigger::pulse_on());
+        auto counter = std::make_unique<CountingNode>("counter" + std::to_string(i), root);
+        auto scaler = std::make_unique<ScalerNode>("scaler" + std::to_string(i), root, trigger.get(), counter.get());
+        auto* scaler_ptr = scaler.get();
+
+        std::vector<std::unique_ptr<Generative>> generatives;
+        generatives.emplace_back(std::move(trigger));
+        generatives.emplace_back(std::move(counter));
+        generatives.emplace_back(std::move(scaler));
+        graph.add(std::move(generatives));
+
+        // without a Root, the scaler is only evaluated (and thus in use by `process` when removed) if observed
+        graph.observe(*scaler_ptr);
+
+        if (i % 2 == 0) {
+            graph.remove_generative_and_children(*scaler_ptr);
+        }
+    }
+
+    running = false;
+    process_thread.join();
+
+    REQUIRE(graph.size() == 500);
+}
+
+
+TEST_CASE("GenerationGraph: cycles are reported when added", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto a = std::make_unique<DependentNode>("a", root);
+    auto b = std::make_unique<DependentNode>("b", root);
+    auto c = std::make_unique<DependentNode>("c", root);
+    auto* a_ptr = a.get();
+    auto* b_ptr = b.get();
+    auto* c_ptr = c.get();
+
+    REQUIRE(graph.add(std::move(a)).empty());
+
+    b->depend_on(*a_ptr);
+    REQUIRE(graph.add(std::move(b)).empty());
+
+    // c -> b -> a -> c
+    c->depend_on(*b_ptr);
+    a_ptr->depend_on(*c_ptr);
+    auto cycles = graph.add(std::move(c));
+
+    REQUIRE(cycles.size() == 1);
+    REQUIRE(cycles[0].size() == 3);
+    REQUIRE(cycles[0][0] == c_ptr);
+
+    // cyclic generatives are still scheduled
+    graph.observe(*c_ptr);
+    REQUIRE(graph.get_schedule().size() == 3);
+    REQUIRE(GraphUtils::find_cycles_through({b_ptr}).size() == 1);
+
+    // a cycle not passing through the added generative is not reported again
+    auto d = std::make_unique<DependentNode>("d", root);
+    d->depend_on(*a_ptr);
+    REQUIRE(graph.add(std::move(d)).empty());
+
+    // once the cycle is broken, the remaining generatives are ordered by dependency rather than by insertion
+    graph.remove(*b_ptr);
+    graph.observe(*a_ptr);
+    REQUIRE(graph.get_schedule() == std::vector<Generative*>{c_ptr, a_ptr});
+}
+
+
+TEST_CASE("GenerationGraph: schedule is ordered by dependency regardless of the order of adding", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto a = std::make_unique<ScalerNode>("a", root, trigger.get());
+    auto b = std::make_unique<ScalerNode>("b", root, trigger.get(), a.get());
+    auto c = std::make_unique<ScalerNode>("c", root, trigger.get(), b.get());
+    auto d = std::make_unique<ScalerNode>("d", root, trigger.get());
+
+    std::vector<Generative*> expected{trigger.get(), d.get(), a.get(), b.get(), c.get()};
+    auto* c_ptr = c.get();
+    auto* d_ptr = d.get();
+
+    // each generative is added before the generatives it depends on
+    graph.add(std::move(c));
+    graph.add(std::move(b));
+    graph.add(std::move(d));
+    graph.add(std::move(a));
+    graph.add(std::move(trigger));
+    graph.observe(*c_ptr);
+    graph.observe(*d_ptr);
+
+    REQUIRE(graph.get_schedule() == expected);
+}
+
+
+TEST_CASE("GenerationGraph: batched edits are published at once", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    graph.begin_edit();
+    graph.begin_edit();
+
+    auto counter = std::make_unique<CountingNode>("counter", root);
+    auto* counter_ptr = counter.get();
+    graph.add(std::move(counter));
+    graph.observe(*counter_ptr);
+    graph.end_edit();
+
+    // still within the outer batch
+    graph.process(TimePoint());
+    REQUIRE(counter_ptr->num_calls() == 0);
+    REQUIRE(graph.get_schedule().empty());
+
+    graph.end_edit();
+    REQUIRE(graph.get_schedule() == std::vector<Generative*>{counter_ptr});
+
+    graph.process(TimePoint(1.0));
+    REQUIRE(counter_ptr->num_calls() == 1);
+}
+
+
+TEST_CASE("GraphUtils: long chains", "[generation_graph]") {
+    ParameterHandler root;
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::make_unique<DependentNode>("0", root));
+    for (std::size_t i = 1; i < 100000; ++i) {
+        auto node = std::make_unique<DependentNode>(std::to_string(i), root);
+        node->depend_on(*generatives.back());
+        generatives.emplace_back(std::move(node));
+    }
+
+    REQUIRE(GraphUtils::find_cycles(generatives).empty());
+
+    auto levels = GraphUtils::topological_levels(generatives);
+    REQUIRE(levels.levels.size() == generatives.size());
+    REQUIRE(levels.unordered.empty());
+}
+
+
+TEST_CASE("GenerationGraph: find by identifier", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto osc = std::make_unique<CountingNode>("osc", root);
+    auto freq = std::make_unique<CountingNode>("osc::freq", root);
+    auto osc1 = std::make_unique<CountingNode>("osc1", root);
+    auto* osc_ptr = osc.get();
+    auto* freq_ptr = freq.get();
+    auto* osc1_ptr = osc1.get();
+
+    graph.add(std::move(osc));
+    graph.add(std::move(freq));
+    graph.add(std::move(osc1));
+
+    REQUIRE(graph.find("osc") == osc_ptr);
+    REQUIRE(graph.find("osc::freq") == freq_ptr);
+    REQUIRE(graph.find("osc::phase") == nullptr);
+
+    auto matching = graph.find_generatives_matching("osc");
+    REQUIRE(matching.size() == 2);
+    REQUIRE(std::find(matching.begin(), matching.end(), osc1_ptr) == matching.end());
+
+    graph.remove_generative_and_children(*osc_ptr);
+    REQUIRE(graph.size() == 1);
+    REQUIRE(graph.find("osc") == nullptr);
+    REQUIRE(graph.find("osc1") == osc1_ptr);
+}
+
+
+TEST_CASE("GenerationGraph: time independent generatives are only evaluated when inputs change", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto value = std::make_unique<Sequence<Facet, double>>("value", root, 0.0);
+    auto pure = std::make_unique<PureNode>("pure", root);
+    pure->depend_on(*value);
+
+    auto* value_ptr = value.get();
+    auto* pure_ptr = pure.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(value));
+    generatives.emplace_back(std::move(pure));
+    graph.add(std::move(generatives));
+    graph.observe(*pure_ptr);
+
+    auto t = TimePoint();
+    for (std::size_t i = 0; i < 10; ++i) {
+        graph.process(t);
+        t.increment(0.1);
+    }
+
+    // first cycle of the snapshot is always fully evaluated
+    REQUIRE(pure_ptr->num_calls() == 1);
+
+    value_ptr->set_values(1.0);
+    graph.process(t);
+    REQUIRE(pure_ptr->num_calls() == 2);
+
+    // unchanged inputs after the change
+    graph.process(t);
+    REQUIRE(pure_ptr->num_calls() == 2);
+
+    t.with_transport_running(false);
+    graph.process(t);
+    REQUIRE(pure_ptr->num_calls() == 3);
+
+    graph.update_schedule();
+    graph.process(t);
+    REQUIRE(pure_ptr->num_calls() == 4);
+
+    // connections outside the graph don't affect it
+    Sequence<Facet, double> other{"other", root, 0.0};
+    Socket<Facet> outside{"outside", root};
+    outside.connect(other);
+    graph.process(t);
+    graph.process(t);
+    REQUIRE(pure_ptr->num_calls() == 4);
+}
+
+
+TEST_CASE("GenerationGraph: only generatives reachable from roots or observed generatives are live", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto counter = std::make_unique<CountingNode>("counter", root);
+    auto orphan = std::make_unique<CountingNode>("orphan", root);
+    auto dependent = std::make_unique<DependentNode>("dependent", root);
+    dependent->depend_on(*counter);
+
+    auto* counter_ptr = counter.get();
+    auto* orphan_ptr = orphan.get();
+    auto* dependent_ptr = dependent.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(counter));
+    generatives.emplace_back(std::move(orphan));
+    generatives.emplace_back(std::move(dependent));
+    graph.add(std::move(generatives));
+
+    REQUIRE(graph.get_schedule().empty());
+    REQUIRE(graph.get_generatives().size() == 3);
+
+    graph.observe(*dependent_ptr);
+    REQUIRE(graph.is_observed(*dependent_ptr));
+    REQUIRE(graph.get_schedule() == std::vector<Generative*>{counter_ptr, dependent_ptr});
+
+    graph.process(TimePoint());
+    REQUIRE(counter_ptr->num_calls() == 1);
+    REQUIRE(orphan_ptr->num_calls() == 0);
+
+    graph.unobserve(*dependent_ptr);
+    REQUIRE(graph.get_schedule().empty());
+
+    graph.process(TimePoint());
+    REQUIRE(counter_ptr->num_calls() == 1);
+
+    // removed generatives are no longer observed
+    graph.observe(*dependent_ptr);
+    graph.remove(*dependent_ptr);
+    REQUIRE_FALSE(graph.is_observed(*dependent_ptr));
+    REQUIRE(graph.get_schedule().empty());
+    REQUIRE_THROWS_AS(graph.observe(*dependent_ptr), std::invalid_argument);
+
+    // generatives outside the graph cannot be observed
+    CountingNode outside{"outside", root};
+    REQUIRE_THROWS_AS(graph.observe(outside), std::invalid_argument);
+    REQUIRE_FALSE(graph.is_observed(outside));
+}
+
+
+TEST_CASE("GenerationGraph: time is published once per cycle to generatives following its frame", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto following = std::make_unique<TimedNode>("following", root, true);
+    auto updated = std::make_unique<TimedNode>("updated", root, false);
+    auto* following_ptr = following.get();
+    auto* updated_ptr = updated.get();
+
+    graph.add(std::move(following));
+    graph.add(std::move(updated));
+    graph.observe(*following_ptr);
+    graph.observe(*updated_ptr);
+
+    REQUIRE_FALSE(following_ptr->pop_tick());
+
+    graph.process(TimePoint(1.0));
+    REQUIRE(following_ptr->num_time_updates() == 0);
+    REQUIRE(updated_ptr->num_time_updates() == 1);
+
+    REQUIRE(following_ptr->pop_tick() == 1.0);
+    REQUIRE(updated_ptr->pop_tick() == 1.0);
+    REQUIRE_FALSE(following_ptr->pop_tick());
+
+    graph.process(TimePoint(2.0));
+    REQUIRE(following_ptr->pop_tick() == 2.0);
+
+    // removed generatives keep following the frame until reclaimed, as the previous snapshot may still evaluate them
+    graph.remove(*following_ptr);
+    REQUIRE(following_ptr->num_time_updates() == 0);
+    graph.process(TimePoint(3.0));
+    REQUIRE(following_ptr->pop_tick() == 3.0);
+}
+
+
+TEST_CASE("GenerationGraph: replacing a generative transfers its connections and hands over held pulses", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto value = std::make_unique<Sequence<Facet, double>>("value", root, 0.25);
+    auto scaler = std::make_unique<ScalerNode>("scaler", root, trigger.get(), value.get());
+    auto consumer = std::make_unique<ScalerNode>("consumer", root, trigger.get(), scaler.get());
+    auto held = std::make_unique<HoldingNode>("held", root, 7);
+
+    auto* trigger_ptr = trigger.get();
+    auto* value_ptr = value.get();
+    auto* scaler_ptr = scaler.get();
+    auto* consumer_ptr = consumer.get();
+    auto* held_ptr = held.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(trigger));
+    generatives.emplace_back(std::move(value));
+    generatives.emplace_back(std::move(scaler));
+    generatives.emplace_back(std::move(consumer));
+    generatives.emplace_back(std::move(held));
+    graph.add(std::move(generatives));
+    graph.observe(*consumer_ptr);
+    graph.observe(*held_ptr);
+
+    graph.process(TimePoint());
+
+    SECTION("connections") {
+        auto replacement = std::make_unique<ScalerNode>("scaler", root);
+        auto* replacement_ptr = replacement.get();
+        REQUIRE(graph.replace(*scaler_ptr, std::move(replacement)).empty());
+
+        // the replacement's sockets are connected by id, consumers are reconnected to the replacement
+        REQUIRE(replacement_ptr->get_connected() == std::vector<Generative*>{trigger_ptr, value_ptr});
+        REQUIRE(consumer_ptr->get_connected() == std::vector<Generative*>{trigger_ptr, replacement_ptr});
+
+        REQUIRE(graph.find("scaler") == replacement_ptr);
+        REQUIRE(graph.size() == 5);
+
+        auto schedule = graph.get_schedule();
+        REQUIRE(std::find(schedule.begin(), schedule.end(), replacement_ptr) != schedule.end());
+        REQUIRE(std::find(schedule.begin(), schedule.end(), scaler_ptr) == schedule.end());
+
+        graph.process(TimePoint(1.0));
+    }
+
+    SECTION("held pulses") {
+        auto replacement = std::make_unique<HoldingNode>("held", root, std::nullopt);
+        auto* replacement_ptr = replacement.get();
+        graph.replace(*held_ptr, std::move(replacement));
+
+        // observed status is carried over
+        REQUIRE(graph.is_observed(*replacement_ptr));
+        REQUIRE(replacement_ptr->latest().is_empty_like());
+
+        graph.process(TimePoint(1.0));
+        REQUIRE(replacement_ptr->latest() == Voices<Trigger>::singular(Trigger::pulse_off(7)));
+
+        // handed over exactly once
+        graph.process(TimePoint(2.0));
+        REQUIRE(replacement_ptr->latest().is_empty_like());
+    }
+
+    SECTION("generatives not in the graph cannot be replaced") {
+        HoldingNode outside{"outside", root, std::nullopt};
+        REQUIRE_THROWS_AS(graph.replace(outside, std::make_unique<HoldingNode>("held", root, std::nullopt))
+                          , std::invalid_argument);
+    }
+}
+
+
+TEST_CASE("GenerationGraph: parameter changes from other threads are applied at the start of a cycle", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto value = std::make_unique<Sequence<Facet, double>>("value", root, 0.0);
+    auto* value_ptr = value.get();
+    graph.add(std::move(value));
+    graph.observe(*value_ptr);
+
+    graph.process(TimePoint());
+
+    REQUIRE(graph.enqueue_change([value_ptr] { value_ptr->set_values(1.0); }));
+    REQUIRE(value_ptr->get_values() == Voices<Facet>::singular(Facet(0.0)));
+
+    graph.process(TimePoint(1.0));
+    REQUIRE(value_ptr->get_values() == Voices<Facet>::singular(Facet(1.0)));
+
+    // concurrent producers while processing
+    static constexpr std::size_t NUM_CHANGES = 500;
+    std::atomic<bool> done{false};
+    std::thread processing([&graph, &done] {
+        auto t = TimePoint();
+        while (!done) {
+            graph.process(t);
+            t.increment(0.1);
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < 2; ++p) {
+        producers.emplace_back([&graph, value_ptr] {
+            for (std::size_t i = 0; i < NUM_CHANGES; ++i) {
+                auto values = Voices<double>::singular(static_cast<double>(i));
+                ParameterChangeQueue::Change change{[value_ptr, values = std::move(values)] {
+                    value_ptr->set_values(values);
+                }};
+                while (!graph.enqueue_change(std::move(change))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& producer: producers) {
+        producer.join();
+    }
+    done = true;
+    processing.join();
+
+    graph.process(TimePoint(2.0));
+    REQUIRE(value_ptr->get_values() == Voices<Facet>::singular(Facet(NUM_CHANGES - 1)));
+}
+
+
+TEST_CASE("GenerationGraph: connections are applied together with the snapshot accounting for them", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto low = std::make_unique<Sequence<Facet, double>>("low", root, 0.25);
+    auto high = std::make_unique<Sequence<Facet, double>>("high", root, 0.75);
+    auto scaler = std::make_unique<ScalerNode>("scaler", root, trigger.get(), low.get());
+
+    auto* high_ptr = high.get();
+    auto* scaler_ptr = scaler.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(trigger));
+    generatives.emplace_back(std::move(low));
+    generatives.emplace_back(std::move(high));
+    generatives.emplace_back(std::move(scaler));
+    graph.add(std::move(generatives));
+    graph.observe(*scaler_ptr);
+    graph.set_num_threads(2);
+
+    auto value_after_cycle = [&graph, scaler_ptr](double tick) {
+        graph.process(TimePoint(tick));
+        return scaler_ptr->process().first_or(Facet(0.0));
+    };
+
+    REQUIRE(value_after_cycle(1.0) == Facet(0.25));
+
+    // connecting directly only changes the connection reported to the editing thread
+    REQUIRE(scaler_ptr->try_connect(ScalerNode::Keys::VALUE, *high_ptr));
+    REQUIRE(scaler_ptr->get_connected().back() == high_ptr);
+    REQUIRE(value_after_cycle(2.0) == Facet(0.25));
+
+    // `high` isn't live yet, but is scheduled before the scaler once the connection is applied
+    graph.update_schedule();
+    auto schedule = graph.get_schedule();
+    REQUIRE(std::find(schedule.begin(), schedule.end(), high_ptr) < std::find(schedule.begin(), schedule.end(), scaler_ptr));
+    REQUIRE(value_after_cycle(3.0) == Facet(0.75));
+}
+
+
+TEST_CASE("GenerationGraph: connecting through the graph takes effect in the next cycle", "[generation_graph]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto low = std::make_unique<Sequence<Facet, double>>("low", root, 0.25);
+    auto high = std::make_unique<Sequence<Facet, double>>("high", root, 0.75);
+    auto scaler = std::make_unique<ScalerNode>("scaler", root, trigger.get(), low.get());
+
+    auto* low_ptr = low.get();
+    auto* high_ptr = high.get();
+    auto* scaler_ptr = scaler.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(trigger));
+    generatives.emplace_back(std::move(low));
+    generatives.emplace_back(std::move(high));
+    generatives.emplace_back(std::move(scaler));
+    graph.add(std::move(generatives));
+    graph.observe(*scaler_ptr);
+
+    auto value_after_cycle = [&graph, scaler_ptr](double tick) {
+        graph.process(TimePoint(tick));
+        return scaler_ptr->process().first_or(Facet(0.0));
+    };
+
+    REQUIRE(value_after_cycle(1.0) == Facet(0.25));
+
+    REQUIRE(graph.connect(*scaler_ptr, ScalerNode::Keys::VALUE, *high_ptr));
+    auto schedule = graph.get_schedule();
+    REQUIRE(std::find(schedule.begin(), schedule.end(), high_ptr) < std::find(schedule.begin(), schedule.end(), scaler_ptr));
+    REQUIRE(value_after_cycle(2.0) == Facet(0.75));
+
+    // connecting directly, followed by an explicit update of the schedule
+    REQUIRE(scaler_ptr->try_connect(ScalerNode::Keys::VALUE, *low_ptr));
+    REQUIRE(value_after_cycle(3.0) == Facet(0.75));
+    graph.update_schedule();
+    REQUIRE(value_after_cycle(4.0) == Facet(0.25));
+
+    REQUIRE_FALSE(graph.connect(*scaler_ptr, "no_such_socket", *high_ptr));
+
+    Sequence<Facet, double> outside{"outside", root, 0.0};
+    REQUIRE_THROWS_AS(graph.connect(outside, ScalerNode::Keys::VALUE, *high_ptr), std::invalid_argument);
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/policies/policies.h"
+#include "core/generation_graph.h"
+#include "core/generatives/outlet.h"
+#include "core/generatives/router.h"
+#include "core/generatives/sequence.h"
+
+using namespace serialist;
+
+
+TEST_CASE("Outlet: exposes a single outlet of a RouterNode", "[outlet]") {
+    RouterFacetWrapper w(2, 2);
+    w.routing_map.set_values(Voices<double>::transposed({1.0, 0.0}));
+    w.set_input(0, Voices<double>::singular(0.25));
+    w.set_input(1, Voices<double>::singular(0.75));
+
+    Outlet<Facet> first{"first", w.ph, &w.router_node, 0};
+    Outlet<Facet> second{"second", w.ph, &w.router_node, 1};
+    Outlet<Facet> out_of_bounds{"out_of_bounds", w.ph, &w.router_node, 2};
+
+    w.router_node.update_time(TimePoint{});
+    REQUIRE(first.process() == Voices<Facet>::singular(Facet(0.75)));
+    REQUIRE(second.process() == Voices<Facet>::singular(Facet(0.25)));
+    REQUIRE(out_of_bounds.process().is_empty_like());
+
+    REQUIRE(first.get_connected() == std::vector<Generative*>{&w.router_node});
+    first.disconnect_if(w.router_node);
+    REQUIRE(first.get_connected().empty());
+    REQUIRE(first.process().is_empty_like());
+}
+
+
+TEST_CASE("Outlet: shares the outlet buffer within GenerationGraph cycles", "[outlet]") {
+    RouterFacetWrapper w(2, 2);
+    w.routing_map.set_values(Voices<double>::transposed({0.0, 1.0}));
+    w.set_input(0, Voices<double>::singular(0.25));
+    w.set_input(1, Voices<double>::singular(0.75));
+
+    auto& router = w.router_node;
+    Outlet<Facet> first{"first", w.ph, &router, 0};
+    Outlet<Facet> second{"second", w.ph, &router, 1};
+
+    auto evaluate = [&](const TimePoint& t) {
+        router.update_time(t);
+        router.evaluate();
+        first.evaluate();
+        second.evaluate();
+    };
+
+    auto clear = [&] {
+        router.clear_output();
+        first.clear_output();
+        second.clear_output();
+    };
+
+    evaluate(TimePoint{});
+    REQUIRE(first.shared_output() == router.shared_output(0));
+    REQUIRE(*second.output() == Voices<Facet>::singular(Facet(0.75)));
+    clear();
+
+    auto first_version = first.get_output_version();
+    auto second_version = second.get_output_version();
+
+    // only the outlet whose value changed gets a new buffer and version
+    w.set_input(1, Voices<double>::singular(0.5));
+    evaluate(TimePoint{1.0});
+    REQUIRE(first.get_output_version() == first_version);
+    REQUIRE(second.get_output_version() == second_version + 1);
+    REQUIRE(*second.output() == Voices<Facet>::singular(Facet(0.5)));
+    clear();
+}
+
+
+TEST_CASE("Outlet: is reconnected when its MultiNode is replaced within a GenerationGraph", "[outlet]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto first = std::make_unique<Sequence<Facet, double>>("first", root, 0.25);
+    auto second = std::make_unique<Sequence<Facet, double>>("second", root, 0.75);
+    auto routing_map = std::make_unique<Sequence<Facet, double>>("routing_map", root
+                                                                 , Voices<double>::transposed({1.0, 0.0}));
+    auto router = std::make_unique<RouterNode<Facet>>("router", root, 2
+                                                      , Vec<Node<Facet>*>{first.get(), second.get()}
+                                                      , routing_map.get());
+    auto outlet = std::make_unique<Outlet<Facet>>("outlet", root, router.get(), 1);
+
+    auto* router_ptr = router.get();
+    auto* outlet_ptr = outlet.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(first));
+    generatives.emplace_back(std::move(second));
+    generatives.emplace_back(std::move(routing_map));
+    generatives.emplace_back(std::move(router));
+    generatives.emplace_back(std::move(outlet));
+    graph.add(std::move(generatives));
+    graph.observe(*outlet_ptr);
+
+    graph.process(TimePoint());
+    REQUIRE(outlet_ptr->process() == Voices<Facet>::singular(Facet(0.25)));
+
+    // a single outlet only, such that the outlet is out of bounds once connected to the replacement
+    auto replacement = std::make_unique<RouterNode<Facet>>("router", root, 1, Vec<Node<Facet>*>{nullptr, nullptr});
+    auto* replacement_ptr = replacement.get();
+    graph.replace(*router_ptr, std::move(replacement));
+
+    REQUIRE(outlet_ptr->get_connected() == std::vector<Generative*>{replacement_ptr});
+    REQUIRE(replacement_ptr->get_connected().size() == 3);
+
+    // the previous router keeps serving the outlet until the next cycle picks up the replacement
+    REQUIRE(outlet_ptr->process() == Voices<Facet>::singular(Facet(0.25)));
+
+    graph.process(TimePoint(1.0));
+    REQUIRE(outlet_ptr->process().is_empty_like());
+}
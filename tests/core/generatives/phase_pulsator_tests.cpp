@@ -996,3 +996,39 @@ TEST_CASE("PhasePulsator: Voice Count edge cases (R1.2.7)", "[phase_pulsator]")
         REQUIRE_THAT(r, mms::size<Trigger>(4));
     }
 }
+
+
+TEST_CASE("PhasePulsator: Triggers carry the position of the crossing within the time step", "[phase_pulsator]") {
+    using Catch::Matchers::WithinAbs;
+
+    PhasePulsator pulsator;
+    pulsator.set_legato(0.5);
+
+    REQUIRE(pulsator.process(Phase(0.8)).empty());
+    REQUIRE(pulsator.process(Phase(0.9)).empty());
+
+    // threshold 0.0 is crossed halfway between 0.9 and 0.1
+    auto triggers = pulsator.process(Phase(0.1));
+    REQUIRE(triggers.size() == 1);
+    REQUIRE(triggers[0].is_pulse_on());
+    REQUIRE_THAT(triggers[0].get_step_offset(), WithinAbs(0.5, 1e-8));
+
+    REQUIRE(pulsator.process(Phase(0.4)).empty());
+
+    // legato threshold 0.5 is crossed a third of the way between 0.4 and 0.7
+    triggers = pulsator.process(Phase(0.7));
+    REQUIRE(triggers.size() == 1);
+    REQUIRE(triggers[0].is_pulse_off());
+    REQUIRE_THAT(triggers[0].get_step_offset(), WithinAbs(1.0 / 3.0, 1e-8));
+
+    SECTION("Jumps occur at the current time point") {
+        REQUIRE(pulsator.process(Phase(0.9)).empty());
+        REQUIRE(pulsator.process(Phase(0.1)).size() == 1);
+
+        // jump across the legato threshold
+        triggers = pulsator.process(Phase(0.6));
+        REQUIRE(triggers.size() == 1);
+        REQUIRE(triggers[0].is_pulse_off());
+        REQUIRE(triggers[0].get_step_offset() == 1.0);
+    }
+}
@@ -132,4 +132,27 @@ TEST_CASE("PulseFilter: Sustain mode", "[pulse_filter]") {
         filter_state.set_values(OPEN);
         REQUIRE_THAT(runner.step(), m1m::equalst_off(id1));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("PulseFilter: Quantized flushes occur at the position of the flushing pulse_off", "[pulse_filter]") {
+    PulseFilter filter;
+
+    auto pulse_on = Trigger::pulse_on();
+    REQUIRE(filter.process(Voice<Trigger>{pulse_on}, PulseFilter::State::open, false).size() == 1);
+
+    // passed through triggers keep their position
+    auto other = Trigger::pulse_on().with_step_offset(0.5);
+    auto r = filter.process(Voice<Trigger>{other}, PulseFilter::State::open, false);
+    REQUIRE(r.size() == 1);
+    REQUIRE(r[0].get_step_offset() == 0.5);
+
+    REQUIRE(filter.process(Voice<Trigger>{}, PulseFilter::State::pause, false).empty());
+
+    r = filter.process(Voice<Trigger>{Trigger::pulse_off(other.get_id()).with_step_offset(0.25)}
+                       , PulseFilter::State::pause
+                       , false);
+    REQUIRE(r.size() == 2);
+    REQUIRE(r.contains(Trigger::pulse_off(pulse_on.get_id())));
+    REQUIRE(r[0].get_step_offset() == 0.25);
+    REQUIRE(r[1].get_step_offset() == 0.25);
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "serialist/core/policies/policies.h"
+#include "core/offline_renderer.h"
+#include "core/generatives/sequence.h"
+#include "core/generatives/scaler.h"
+
+using namespace serialist;
+
+
+TEST_CASE("OfflineRenderer: renders every step in interval", "[offline_renderer]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto sequence = std::make_unique<Sequence<Facet>>("sequence", root, Facet(0.5));
+    auto* sequence_ptr = sequence.get();
+    graph.add(std::move(sequence));
+
+    OfflineRenderer<Facet> renderer{graph, DomainDuration::ticks(0.25)};
+    REQUIRE(renderer.add_output(*sequence_ptr) == 0);
+
+    auto rendered = renderer.render(DomainTimePoint::ticks(1.0), DomainTimePoint::ticks(5.0));
+    REQUIRE(rendered.size() == 16);
+    REQUIRE_THAT(rendered[0].time.get_tick(), Catch::Matchers::WithinAbs(1.0, 1e-8));
+    REQUIRE_THAT(rendered[15].time.get_tick(), Catch::Matchers::WithinAbs(4.75, 1e-8));
+    REQUIRE(rendered[0].output_index == 0);
+    REQUIRE(rendered[0].voices == Voices<Facet>::singular(Facet(0.5)));
+}
+
+
+TEST_CASE("OfflineRenderer: meter and tempo changes", "[offline_renderer]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+    graph.add(std::make_unique<Sequence<Facet>>("sequence", root, Facet(0.5)));
+
+    OfflineRenderer<Facet> renderer{graph, DomainDuration::ticks(0.25)};
+    renderer.add_terminal_outputs();
+    REQUIRE(renderer.get_outputs().size() == 1);
+
+    renderer.schedule_meter_change(1, Meter(3, 4));
+    renderer.schedule_tempo_change(DomainTimePoint::bars(2.0), 60.0);
+
+    // bar 0 in 4/4 (4 ticks) followed by two bars in 3/4 (3 ticks each)
+    auto rendered = renderer.render(DomainTimePoint::zero(), DomainTimePoint::bars(3.0));
+    REQUIRE(rendered.size() == 40);
+
+    REQUIRE(rendered.first()->time.get_meter() == Meter(4, 4));
+    REQUIRE(rendered.last()->time.get_meter() == Meter(3, 4));
+
+    REQUIRE(rendered[27].time.get_tempo() == 120.0);
+    REQUIRE(rendered[28].time.get_tempo() == 60.0);
+}
+
+
+TEST_CASE("OfflineRenderer: terminal outputs", "[offline_renderer]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto trigger = std::make_unique<Sequence<Trigger>>("trigger", root, Trigger::pulse_on());
+    auto value = std::make_unique<Sequence<Facet>>("value", root, Facet(0.5));
+    auto scaler = std::make_unique<ScalerNode>("scaler", root, trigger.get(), value.get());
+    auto* scaler_ptr = scaler.get();
+
+    std::vector<std::unique_ptr<Generative>> generatives;
+    generatives.emplace_back(std::move(trigger));
+    generatives.emplace_back(std::move(value));
+    generatives.emplace_back(std::move(scaler));
+    graph.add(std::move(generatives));
+
+    OfflineRenderer<Facet> renderer{graph, DomainDuration::ticks(0.1)};
+    renderer.add_terminal_outputs();
+    REQUIRE(renderer.get_outputs() == std::vector<Node<Facet>*>{scaler_ptr});
+}
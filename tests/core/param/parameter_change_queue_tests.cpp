@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <thread>
+
+#include "core/param/parameter_change_queue.h"
+
+using namespace serialist;
+
+TEST_CASE("ParameterChangeQueue: changes are applied in order until the queue is full", "[parameter_change_queue]") {
+    ParameterChangeQueue queue{3};
+    REQUIRE(queue.capacity() == 4);
+
+    std::vector<int> applied;
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(queue.push([&applied, i] { applied.push_back(i); }));
+    }
+    REQUIRE_FALSE(queue.push([&applied] { applied.push_back(-1); }));
+    REQUIRE(applied.empty());
+
+    REQUIRE(queue.apply_pending() == 4);
+    REQUIRE(applied == std::vector<int>{0, 1, 2, 3});
+    REQUIRE(queue.num_pushed() == 4);
+    REQUIRE(queue.num_applied() == 4);
+
+    // cells are reused once applied
+    REQUIRE(queue.push([&applied] { applied.push_back(4); }));
+    REQUIRE(queue.apply_pending() == 1);
+    REQUIRE(queue.apply_pending() == 0);
+    REQUIRE(applied.back() == 4);
+}
+
+
+TEST_CASE("ParameterChangeQueue: changes throwing an exception are dropped", "[parameter_change_queue]") {
+    ParameterChangeQueue queue;
+    int value = 0;
+
+    queue.push([] { throw std::runtime_error("error"); });
+    queue.push([&value] { value = 1; });
+
+    REQUIRE(queue.apply_pending() == 2);
+    REQUIRE(value == 1);
+    REQUIRE(queue.num_failed() == 1);
+    REQUIRE(queue.num_applied() == 2);
+}
+
+
+TEST_CASE("ParameterChangeQueue: applied changes are destroyed when their cell is reused", "[parameter_change_queue]") {
+    ParameterChangeQueue queue{2};
+    auto captured = std::make_shared<int>(0);
+
+    REQUIRE(queue.push([captured] { ++*captured; }));
+    REQUIRE(captured.use_count() == 2);
+
+    REQUIRE(queue.apply_pending() == 1);
+    REQUIRE(*captured == 1);
+    REQUIRE(captured.use_count() == 2);
+
+    // second cell
+    REQUIRE(queue.push([] {}));
+    REQUIRE(captured.use_count() == 2);
+
+    // back to the first cell: destroyed by the producer
+    REQUIRE(queue.push([] {}));
+    REQUIRE(captured.use_count() == 1);
+}
+
+
+TEST_CASE("ParameterChangeQueue: Change is move-only and stored inline", "[parameter_change_queue]") {
+    auto value = std::make_unique<int>(0);
+    auto* ptr = value.get();
+
+    ParameterChangeQueue::Change change{[v = std::move(value)] { ++*v; }};
+    REQUIRE(change);
+
+    auto moved = std::move(change);
+    REQUIRE_FALSE(change);
+    REQUIRE(moved);
+
+    moved();
+    REQUIRE(*ptr == 1);
+
+    moved.reset();
+    REQUIRE_FALSE(moved);
+}
+
+
+TEST_CASE("ParameterChangeQueue: concurrent producers", "[parameter_change_queue]") {
+    static constexpr std::size_t NUM_PRODUCERS = 4;
+    static constexpr std::size_t NUM_CHANGES = 2000;
+
+    ParameterChangeQueue queue{64};
+
+    // only accessed by the consumer
+    std::vector<std::size_t> latest(NUM_PRODUCERS, 0);
+    bool in_order = true;
+
+    std::atomic<bool> done{false};
+    std::thread consumer([&] {
+        while (!done) {
+            queue.apply_pending();
+        }
+        queue.apply_pending();
+    });
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < NUM_PRODUCERS; ++p) {
+        producers.emplace_back([&queue, &latest, &in_order, p] {
+            for (std::size_t i = 1; i <= NUM_CHANGES; ++i) {
+                while (!queue.push([&latest, &in_order, p, i] {
+                    in_order = in_order && latest[p] + 1 == i;
+                    latest[p] = i;
+                })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& producer: producers) {
+        producer.join();
+    }
+    done = true;
+    consumer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(latest == std::vector<std::size_t>(NUM_PRODUCERS, NUM_CHANGES));
+    REQUIRE(queue.num_applied() == NUM_PRODUCERS * NUM_CHANGES);
+}
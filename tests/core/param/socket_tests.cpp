@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "serialist/core/policies/policies.h"
+#include "core/generation_graph.h"
+#include "core/generatives/scaler.h"
+#include "core/generatives/sequence.h"
+#include "core/param/multi_socket.h"
+#include "core/param/socket_handler.h"
+
+using namespace serialist;
+
+
+TEST_CASE("Socket: reads within a cycle share the node's output", "[socket]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto sequence = std::make_unique<Sequence<Facet, double>>("sequence", root, 0.5);
+    auto* sequence_ptr = sequence.get();
+    graph.add(std::move(sequence));
+    graph.observe(*sequence_ptr);
+
+    Socket<Facet> a{"a", root, sequence_ptr};
+    Socket<Facet> b{"b", root, sequence_ptr};
+
+    // outside a cycle, the node is pulled
+    REQUIRE(a.read() != b.read());
+    REQUIRE(*a.read() == *b.read());
+
+    // within a cycle, the stored output is shared
+    sequence_ptr->evaluate();
+    REQUIRE(a.read() == b.read());
+    REQUIRE(a.read().get() == sequence_ptr->output());
+    sequence_ptr->clear_output();
+}
+
+
+TEST_CASE("Socket: has_changed", "[socket]") {
+    ParameterHandler root;
+    Sequence<Facet, double> first{"first", root, 0.5};
+    Sequence<Facet, double> second{"second", root, 0.5};
+
+    Socket<Facet> socket{"socket", root, &first};
+    REQUIRE(socket.has_changed());
+    REQUIRE_FALSE(socket.has_changed());
+
+    // other reads don't affect change detection
+    first.set_values(0.25);
+    socket.process();
+    socket.voice_count();
+    REQUIRE(socket.has_changed());
+    REQUIRE_FALSE(socket.process_if_changed());
+
+    first.set_values(0.5);
+    REQUIRE(socket.process_if_changed() == Voices<Facet>::singular(Facet(0.5)));
+
+    // a new connection is always considered changed
+    socket.connect(second);
+    REQUIRE(socket.has_changed());
+}
+
+
+TEST_CASE("Socket: has_changed within GenerationGraph cycles", "[socket]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto sequence = std::make_unique<Sequence<Facet, double>>("sequence", root, 0.5);
+    auto* sequence_ptr = sequence.get();
+    graph.add(std::move(sequence));
+    graph.observe(*sequence_ptr);
+
+    Socket<Facet> socket{"socket", root, sequence_ptr};
+
+    auto has_changed_in_cycle = [&] {
+        sequence_ptr->evaluate();
+        auto changed = socket.has_changed();
+        sequence_ptr->clear_output();
+        return changed;
+    };
+
+    REQUIRE(has_changed_in_cycle());
+    REQUIRE_FALSE(has_changed_in_cycle());
+
+    auto version = sequence_ptr->get_output_version();
+    sequence_ptr->set_values(0.25);
+    REQUIRE(has_changed_in_cycle());
+    REQUIRE(sequence_ptr->get_output_version() == version + 1);
+    REQUIRE_FALSE(has_changed_in_cycle());
+}
+
+
+TEST_CASE("Socket: connections changed concurrently with processing", "[socket]") {
+    ParameterHandler root;
+    Sequence<Facet, double> first{"first", root, 0.5};
+    Sequence<Facet, double> second{"second", root, 0.25};
+
+    Socket<Facet> socket{"socket", root, &first};
+
+    std::atomic<bool> running{true};
+    std::atomic<bool> valid{true};
+    std::thread process_thread([&socket, &running, &valid] {
+        while (running) {
+            auto value = socket.read();
+            if (!value->is_empty_like() && value->first_or(0.0) <= 0.0)
+                valid = false;
+        }
+    });
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        if (i % 3 == 0) {
+            socket.disconnect();
+        } else {
+            socket.connect(i % 2 == 0 ? first : second);
+        }
+    }
+
+    running = false;
+    process_thread.join();
+
+    REQUIRE(valid);
+}
+
+
+TEST_CASE("Socket: reads are memoized per cycle of the owning SocketHandler", "[socket]") {
+    ParameterHandler root;
+    Sequence<Facet, double> sequence{"sequence", root, 0.5};
+
+    SocketHandler handler{root};
+    auto& socket = handler.create_socket<Facet>("socket", &sequence);
+
+    // no cycle has been started: every read pulls the node
+    auto first = socket.read();
+    REQUIRE(socket.read() != first);
+
+    handler.update_time(TimePoint{});
+    auto cached = socket.read();
+    sequence.set_values(Voices<double>::transposed({0.25, 0.75}));
+    REQUIRE(socket.read() == cached);
+    REQUIRE(socket.voice_count() == 1);
+    REQUIRE(socket.process() == Voices<Facet>::singular(Facet(0.5)));
+
+    handler.update_time(TimePoint{});
+    REQUIRE(socket.voice_count() == 2);
+    REQUIRE(socket.read() != cached);
+
+    // a new connection is never served from the cache
+    Sequence<Facet, double> other{"other", root, 0.125};
+    socket.connect(other);
+    REQUIRE(socket.process() == Voices<Facet>::singular(Facet(0.125)));
+}
+
+
+TEST_CASE("Socket: only connects to nodes of its own type", "[socket]") {
+    ParameterHandler root;
+    Sequence<Facet, double> facet{"facet", root, 0.5};
+    Sequence<Trigger> trigger{"trigger", root, Trigger::pulse_on()};
+
+    Socket<Facet> socket{"socket", root};
+    REQUIRE(socket.is_connectable(facet));
+    REQUIRE_FALSE(socket.is_connectable(trigger));
+
+    REQUIRE_FALSE(socket.try_connect(trigger));
+    REQUIRE_FALSE(socket.is_connected());
+
+    REQUIRE(socket.try_connect(facet));
+    REQUIRE(socket.get_connected() == &facet);
+
+    REQUIRE(node_cast<Facet>(&facet) == &facet);
+    REQUIRE(node_cast<Trigger>(&facet) == nullptr);
+    REQUIRE(facet.as_root() == nullptr);
+}
+
+
+TEST_CASE("MultiSocket: only copies inlets whose output changed", "[socket]") {
+    ParameterHandler root;
+    GenerationGraph graph{root};
+
+    auto first = std::make_unique<Sequence<Facet, double>>("first", root, 0.5);
+    auto second = std::make_unique<Sequence<Facet, double>>("second", root, 0.25);
+    auto* first_ptr = first.get();
+    auto* second_ptr = second.get();
+    graph.add(std::move(first));
+    graph.add(std::move(second));
+
+    SocketHandler handler{root};
+    MultiSocket<Facet> inputs{Vec<Node<Facet>*>{first_ptr, second_ptr}, handler, "input"};
+
+    auto process_in_cycle = [&] {
+        first_ptr->evaluate();
+        second_ptr->evaluate();
+        const auto& values = inputs.process();
+        first_ptr->clear_output();
+        second_ptr->clear_output();
+        return &values;
+    };
+
+    const auto* values = process_in_cycle();
+    REQUIRE(values->size() == 2);
+    REQUIRE((*values)[0] == Voices<Facet>::singular(Facet(0.5)));
+    REQUIRE((*values)[1] == Voices<Facet>::singular(Facet(0.25)));
+
+    const auto* second_data = (*values)[1].vec().vector().data();
+    first_ptr->set_values(0.75);
+
+    // the buffer is reused, and the unchanged inlet isn't copied again
+    REQUIRE(process_in_cycle() == values);
+    REQUIRE((*values)[0] == Voices<Facet>::singular(Facet(0.75)));
+    REQUIRE((*values)[1].vec().vector().data() == second_data);
+}
@@ -345,3 +345,20 @@ TEST_CASE("Phase: wraps_around", "[phase]") {
 
     REQUIRE_FALSE(Phase::wraps_around(Phase{0.0}, Phase{0.0}));
 }
+
+
+TEST_CASE("Phase: crossing_fraction", "[phase]") {
+    using Catch::Matchers::WithinAbs;
+
+    REQUIRE_THAT(Phase::crossing_fraction(Phase(0.2), Phase(0.6), Phase(0.3)), WithinAbs(0.25, 1e-8));
+
+    // wrap around in both directions
+    REQUIRE_THAT(Phase::crossing_fraction(Phase(0.9), Phase(0.1), Phase::zero()), WithinAbs(0.5, 1e-8));
+    REQUIRE_THAT(Phase::crossing_fraction(Phase(0.1), Phase(0.7), Phase::zero(), Phase::Direction::backward)
+                 , WithinAbs(0.25, 1e-8));
+
+    // positions outside the transition are clipped to its end points
+    REQUIRE(Phase::crossing_fraction(Phase(0.2), Phase(0.3), Phase(0.9), Phase::Direction::forward) == 1.0);
+
+    REQUIRE(Phase::crossing_fraction(Phase(0.5), Phase(0.5), Phase(0.5)) == 1.0);
+}
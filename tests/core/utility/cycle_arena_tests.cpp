@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "core/utility/cycle_arena.h"
+#include "core/collections/small_vector.h"
+
+using namespace serialist;
+
+TEST_CASE("CycleArena: freed blocks are recycled without new chunks", "[cycle_arena]") {
+    auto arena = CycleArena::create();
+    ThreadMemoryResource::Scope scope{*arena};
+    REQUIRE(ThreadMemoryResource::get() == arena.get());
+
+    auto* p = arena->allocate(24);
+    arena->deallocate(p, 24);
+    REQUIRE(arena->num_chunks() == 1);
+
+    // same size class
+    auto* q = arena->allocate(32);
+    REQUIRE(q == p);
+    arena->deallocate(q, 32);
+
+    for (int i = 0; i < 1000; ++i) {
+        auto* r = arena->allocate(1000);
+        arena->deallocate(r, 1000);
+    }
+    REQUIRE(arena->num_chunks() == 1);
+
+    // served by the upstream resource
+    auto* large = arena->allocate(CycleArena::MAX_BLOCK_SIZE + 1);
+    arena->deallocate(large, CycleArena::MAX_BLOCK_SIZE + 1);
+    REQUIRE(arena->num_chunks() == 1);
+}
+
+
+TEST_CASE("CycleArena: containers return memory to the resource they were allocated from", "[cycle_arena]") {
+    auto arena = CycleArena::create();
+    REQUIRE(ThreadMemoryResource::get() == std::pmr::new_delete_resource());
+
+    const int* data;
+    {
+        SmallVector<int, 2> v;
+        {
+            ThreadMemoryResource::Scope scope{*arena};
+            v = {1, 2, 3, 4};
+            data = v.data();
+        }
+        REQUIRE(ThreadMemoryResource::get() == std::pmr::new_delete_resource());
+
+        // grows outside the scope: new buffer from the default resource, old one returned to the arena
+        v.push_back(5);
+        REQUIRE(v.data() != data);
+        REQUIRE(v == SmallVector<int, 2>{1, 2, 3, 4, 5});
+    }
+
+    // freed outside of the scope: only recycled once reclaimed
+    ThreadMemoryResource::Scope scope{*arena};
+    auto* p = arena->allocate(4 * sizeof(int), alignof(int));
+    REQUIRE(p != data);
+    arena->reclaim_remote();
+    auto* q = arena->allocate(4 * sizeof(int), alignof(int));
+    REQUIRE(q == data);
+
+    arena->deallocate(p, 4 * sizeof(int), alignof(int));
+    arena->deallocate(q, 4 * sizeof(int), alignof(int));
+}
+
+
+TEST_CASE("CycleArena: blocks may outlive the handle and be freed from other threads", "[cycle_arena]") {
+    std::vector<SmallVector<int, 0>> vectors;
+    {
+        auto arena = CycleArena::create();
+        ThreadMemoryResource::Scope scope{*arena};
+        for (int i = 0; i < 100; ++i) {
+            vectors.emplace_back(static_cast<std::size_t>(i + 1), i);
+        }
+    }
+
+    std::thread other([&vectors] {
+        // the arena is destroyed along with its last block
+        vectors.clear();
+    });
+    other.join();
+
+    REQUIRE(vectors.empty());
+}
+
+
+TEST_CASE("CycleArena: blocks too large to be pooled may outlive the handle", "[cycle_arena]") {
+    SmallVector<char, 0> large;
+    {
+        auto arena = CycleArena::create();
+        ThreadMemoryResource::Scope scope{*arena};
+        large.resize(CycleArena::MAX_BLOCK_SIZE + 1);
+    }
+
+    // returned through the arena, which therefore must still be alive
+    large = SmallVector<char, 0>();
+    REQUIRE(large.empty());
+}
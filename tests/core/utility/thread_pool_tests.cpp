@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include "core/utility/thread_pool.h"
+
+using namespace serialist;
+
+TEST_CASE("ThreadPool: parallel_for visits every index exactly once", "[thread_pool]") {
+    ThreadPool pool{4};
+    REQUIRE(pool.num_threads() == 4);
+
+    std::vector<std::atomic<int>> visits(1000);
+
+    for (std::size_t job = 0; job < 50; ++job) {
+        pool.parallel_for(visits.size(), [&visits](std::size_t i) { ++visits[i]; });
+    }
+
+    for (const auto& v: visits) {
+        REQUIRE(v == 50);
+    }
+}
+
+
+TEST_CASE("ThreadPool: exceptions are propagated to caller", "[thread_pool]") {
+    ThreadPool pool{3};
+    std::atomic<std::size_t> num_calls{0};
+
+    REQUIRE_THROWS_AS(pool.parallel_for(100, [&num_calls](std::size_t i) {
+        ++num_calls;
+        if (i == 17)
+            throw std::runtime_error("error");
+    }), std::runtime_error);
+
+    // remaining tasks are still executed before the exception is rethrown
+    REQUIRE(num_calls == 100);
+
+    // pool is still usable after an exception
+    pool.parallel_for(10, [&num_calls](std::size_t) { ++num_calls; });
+    REQUIRE(num_calls == 110);
+}
+
+
+TEST_CASE("ThreadPool: single thread runs on caller", "[thread_pool]") {
+    ThreadPool pool{1};
+    auto caller = std::this_thread::get_id();
+
+    pool.parallel_for(10, [&caller](std::size_t) { REQUIRE(std::this_thread::get_id() == caller); });
+}
+
+
+TEST_CASE("ThreadPool: tasks report the executing thread", "[thread_pool]") {
+    ThreadPool pool{4};
+    std::vector<std::size_t> threads(1000, 4);
+
+    pool.parallel_for(threads.size(), [&threads](std::size_t i, std::size_t thread) { threads[i] = thread; });
+
+    for (auto thread: threads) {
+        REQUIRE(thread < 4);
+    }
+}
+
+
+TEST_CASE("ThreadPool: idle threads steal from slow ones", "[thread_pool]") {
+    ThreadPool pool{4};
+    std::vector<std::atomic<int>> visits(64);
+
+    // all slow tasks fall in the range initially assigned to the calling thread
+    for (std::size_t job = 0; job < 10; ++job) {
+        pool.parallel_for(visits.size(), [&visits](std::size_t i) {
+            if (i < visits.size() / 4)
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            ++visits[i];
+        });
+    }
+
+    for (const auto& v: visits) {
+        REQUIRE(v == 10);
+    }
+}
@@ -23,10 +23,11 @@ public:
     }
 
 
-    Voices<Facet> process() override {
+    const Voices<Facet>& process() override {
         double add = m_add_seq.process().first_or(0.0);
         double mul = m_mul_var.process().first_or(1.0);
-        return Voices<Facet>::singular(Facet(mul * m_current_time.get(m_domain_type)) + add);
+        m_current_value = Voices<Facet>::singular(Facet(mul * m_current_time.get(m_domain_type)) + add);
+        return m_current_value;
     }
 
 
@@ -37,6 +38,7 @@ public:
 
 private:
     DomainType m_domain_type;
+    Voices<Facet> m_current_value = Voices<Facet>::empty_like();
 
     ParameterHandler m_ph = ParameterHandler();
 